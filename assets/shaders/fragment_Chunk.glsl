@@ -2,23 +2,27 @@
 out vec4 FragColor;
 
 in vec2 TexCoord;
+flat in vec2 TileOrigin;
 in float Visibility; // 1.0 = Clear, 0.0 = Full Fog
 in vec3 VoxelUVW; // From Vertex Shader
+flat in int ThermalSlot; // This draw's atlas slot, -1 when the chunk is cold
 
 uniform sampler2D u_Texture;
-layout(binding = 1) uniform sampler3D u_ThermalTexture; // The 3D temperature volume (Unit 1)
+const float ATLAS_TILES = 16.0;
+layout(binding = 1) uniform sampler3D u_ThermalAtlas; // Every heated chunk's field (Unit 1)
 
 void main()
 {
-    // 1. Sample Texture
-    vec4 texColor = texture(u_Texture, TexCoord);
+    // 1. Sample Texture: repeat the tile once per block (V = 0 is the bottom of the tile)
+    vec2 vTileUV = vec2(fract(TexCoord.x), 1.0 - fract(TexCoord.y));
+    vec4 texColor = texture(u_Texture, TileOrigin + vTileUV / ATLAS_TILES);
     
     // Alpha discard for transparency (leaves, glass, etc.)
     if(texColor.a < 0.1)
         discard;
     
     // Read raw temperature value
-    float temp = texture(u_ThermalTexture, VoxelUVW).r;
+    float temp = ThermalSlot < 0 ? 0.0 : texture(u_ThermalAtlas, VoxelUVW).r;
 
 	// Calculate Heat Glow Color (Mapping 0.0 -> 5000.0)
     vec3 glowColor = vec3(0.0);
@@ -1,15 +1,36 @@
 #version 450 core
 
-layout (location = 0) in vec3 aPos;
-layout (location = 1) in vec2 aTexCoord;
+// Vertex pulling: no vertex attributes. One packed face per quad (see PackChunkFace): bits 0-11
+// chunk-local origin cell X, Y, Z (4 bits each), 12-15 and 16-19 extent - 1 along the face's
+// U and V axes, 20-22 FaceDirection, 23-30 texture atlas tile (column + row * 16)
+// All chunks share one buffer (the geometry arena): each indirect draw's baseVertex is 4x the
+// index of its first face, so gl_VertexID / 4 lands on the right face
+layout(std430, binding = 0) readonly buffer ChunkFaces {
+    uint aFaces[];
+};
+
+// Per-draw data, indexed by the draw ID (the command's baseInstance, fed through an instanced
+// attribute over 0, 1, 2, ...)
+struct ChunkDraw {
+    vec2 Offset;      // World X, Z of the chunk's origin
+    int ThermalSlot;  // -1: cold chunk, nothing to sample
+    int Padding;
+};
+layout(std430, binding = 2) readonly buffer ChunkDraws {
+    ChunkDraw aDraws[];
+};
+layout(location = 0) in uint aDrawID;
 
 out vec2 TexCoord;
+flat out vec2 TileOrigin; // Atlas UV of the tile's top left corner
 out float Visibility; // For Fog Calculation
-out vec3 VoxelUVW; // 3D Texture Coordinate
+out vec3 VoxelUVW; // 3D Texture Coordinate (inside this chunk's atlas slot)
+flat out int ThermalSlot;
 
 uniform mat4 uViewProjection; // Camera View * Projection Matrix
 
-uniform vec2 u_ChunkOffset;
+uniform ivec2 u_ThermalAtlasGrid; // Slots per atlas row (X) and column (Y)
+layout(binding = 1) uniform sampler3D u_ThermalAtlas;
 
 // Fog Settings
 // Lower density = thicker fog further away
@@ -19,19 +40,57 @@ const float gradient = 1.5;
 
 // The texture is now padded by 1 on all sides
 const float PADDED_TEX_SIZE = 18.0; 
+const float ATLAS_TILES = 16.0;
+
+// Copy of FACE_LAYOUTS (Chunk.cpp): per FaceDirection, the corner offsets in winding order and
+// the axes the face's extents run along
+const vec3 FACE_CORNERS[24] = vec3[](
+    vec3(0, 0, 1), vec3(1, 0, 1), vec3(1, 1, 1), vec3(0, 1, 1),  // FRONT (Z+)
+    vec3(0, 0, 0), vec3(0, 1, 0), vec3(1, 1, 0), vec3(1, 0, 0),  // BACK (Z-)
+    vec3(0, 0, 0), vec3(0, 0, 1), vec3(0, 1, 1), vec3(0, 1, 0),  // LEFT (X-)
+    vec3(1, 0, 0), vec3(1, 1, 0), vec3(1, 1, 1), vec3(1, 0, 1),  // RIGHT (X+)
+    vec3(0, 1, 0), vec3(0, 1, 1), vec3(1, 1, 1), vec3(1, 1, 0),  // UP (Y+)
+    vec3(0, 0, 0), vec3(1, 0, 0), vec3(1, 0, 1), vec3(0, 0, 1)); // DOWN (Y-)
+const int FACE_AXIS_U[6] = int[](0, 0, 2, 2, 0, 0);
+const int FACE_AXIS_V[6] = int[](1, 1, 1, 1, 2, 2);
+
 void main()
 {
+    ChunkDraw objDraw = aDraws[aDrawID];
+
+    // 4 vertices per face, triangulated by the shared quad index buffer
+    uint uiPacked = aFaces[gl_VertexID >> 2];
+    uint uiFace = (uiPacked >> 20) & 7u;
+    vec3 vSize = vec3(1.0);
+    vSize[FACE_AXIS_U[uiFace]] = float(((uiPacked >> 12) & 15u) + 1u);
+    vSize[FACE_AXIS_V[uiFace]] = float(((uiPacked >> 16) & 15u) + 1u);
+    vec3 vOrigin = vec3(uiPacked & 15u, (uiPacked >> 4) & 15u, (uiPacked >> 8) & 15u);
+    vec3 vLocal = vOrigin + FACE_CORNERS[uiFace * 4u + uint(gl_VertexID & 3)] * vSize;
+    float fTile = float((uiPacked >> 23) & 255u);
+
     // 1. Calculate Clip Space Position
-	gl_Position = uViewProjection * vec4(aPos, 1.0);
+    vec3 vWorld = vLocal + vec3(objDraw.Offset.x, 0.0, objDraw.Offset.y);
+	gl_Position = uViewProjection * vec4(vWorld, 1.0);
     
-    // 2. Pass Texture Coordinates
-	TexCoord = aTexCoord;
+    // 2. Texture Coordinates in blocks, from the position along the face (the tile repeats once
+    // per block, so only the fractional part matters and the quad's origin drops out)
+    if (uiFace < 2u)
+        TexCoord = vLocal.xy; // FRONT, BACK
+    else if (uiFace < 4u)
+        TexCoord = vLocal.zy; // LEFT, RIGHT
+    else
+        TexCoord = vec2(vLocal.x, -vLocal.z); // UP, DOWN
+    TileOrigin = vec2(mod(fTile, ATLAS_TILES), floor(fTile / ATLAS_TILES)) / ATLAS_TILES;
 	
-	// Calculate normalized 3D coordinate (0.0 to 1.0) mapping the 16x16x16 chunk
-    float fLocalX = aPos.x - u_ChunkOffset.x;
-    float fLocalY = aPos.y;
-    float fLocalZ = aPos.z - u_ChunkOffset.y;
-    VoxelUVW = (vec3(fLocalX, fLocalY, fLocalZ) + 1.0) / PADDED_TEX_SIZE;
+	// Map the 16x16x16 chunk into its 18^3 slot of the atlas (X first, then Y, then Z)
+    ThermalSlot = objDraw.ThermalSlot;
+    int iSlot = max(objDraw.ThermalSlot, 0);
+    ivec3 vSlotCoord = ivec3(iSlot % u_ThermalAtlasGrid.x,
+                             (iSlot / u_ThermalAtlasGrid.x) % u_ThermalAtlasGrid.y,
+                             iSlot / (u_ThermalAtlasGrid.x * u_ThermalAtlasGrid.y));
+    vec3 vSlotOrigin = vec3(vSlotCoord) * PADDED_TEX_SIZE;
+    VoxelUVW = (vSlotOrigin + vLocal + 1.0) /
+               vec3(textureSize(u_ThermalAtlas, 0));
     
     // 3. Calculate Fog Visibility based on distance from camera
     // gl_Position.z is the depth/distance relative to the camera
@@ -112,13 +112,44 @@ void Application::RenderMetricsUI(App::InputHandler& inputHandler,
         if (ImGui::Checkbox("Neighbor Face Culling", &m_bEnableNeighborCulling)) {
             inputHandler.SetNeighborCullingEnable(m_bEnableNeighborCulling);
         }
+        if (ImGui::Checkbox("Greedy Meshing", &m_bEnableGreedyMeshing)) {
+            inputHandler.SetGreedyMeshingEnable(m_bEnableGreedyMeshing);
+        }
+        if (ImGui::SliderInt("Upload KB / Frame", &m_iMeshUploadBudgetKB, 16, 4096)) {
+            inputHandler.SetMeshUploadBudgetKB(m_iMeshUploadBudgetKB);
+        }
+        if (ImGui::SliderFloat("Upload ms / Frame", &m_fMeshUploadBudgetMs, 0.25f, 16.0f)) {
+            inputHandler.SetMeshUploadBudgetMs(m_fMeshUploadBudgetMs);
+        }
+        if (ImGui::SliderInt("Render Distance", &m_iRenderDistance, 2, 48)) {
+            inputHandler.SetRenderDistance(m_iRenderDistance);
+        }
+        if (ImGui::Checkbox("Mesh LOD", &m_bEnableMeshLod)) {
+            inputHandler.SetEnableMeshLod(m_bEnableMeshLod);
+        }
+        if (m_bEnableMeshLod) {
+            if (ImGui::SliderInt("Full Res Mesh Radius", &m_iMeshLodRadius, 1, 16)) {
+                inputHandler.SetMeshLodRadius(m_iMeshLodRadius);
+            }
+        }
         if (ImGui::Checkbox("Frustrum Culling", &m_bFrustumCulling)) {
             inputHandler.SetFrustumCullingEnable(m_bFrustumCulling);
         }
+        if (ImGui::Checkbox("Occlusion Culling", &m_bOcclusionCulling)) {
+            inputHandler.SetOcclusionCullingEnable(m_bOcclusionCulling);
+        }
+        if (ImGui::Checkbox("Front-To-Back Draw Order", &m_bFrontToBack)) {
+            inputHandler.SetFrontToBackEnable(m_bFrontToBack);
+        }
         ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(0.2f, 1.0f, 0.2f, 1.0f));
         if (ImGui::Checkbox("Enable SIMD", &m_bEnableSIMD)) {
             inputHandler.SetEnableSIMD(m_bEnableSIMD);
         }
+        ImGui::SameLine();
+        ImGui::Text("(%s)", m_pcSimdIsa);
+        if (ImGui::Checkbox("Temporal Blocking", &m_bEnableTemporalBlocking)) {
+            inputHandler.SetEnableTemporalBlocking(m_bEnableTemporalBlocking);
+        }
         ImGui::PopStyleColor();
     }
 
@@ -154,10 +185,65 @@ void Application::RenderMetricsUI(App::InputHandler& inputHandler,
         ImGui::TextColored(ImVec4(1.0f, 0.8f, 0.0f, 1), "Generated By CPU");
         ImGui::Text("Vertices: %zu", objChunkManager.GetGeneratedVertCount());
         ImGui::Text("Triangles: %zu", objChunkManager.GetGeneratedTriaCount());
+        ImGui::Text("Mesh Memory: %.1f KB",
+                    static_cast<double>(objChunkManager.GetGeneratedMeshBytes()) / 1024.0);
 
         ImGui::TextColored(ImVec4(1.0f, 0.0f, 0.8f, 1), "Uploaded To GPU (Within Frustum)");
         ImGui::Text("Vertices: %zu", objChunkManager.GetUploadedVertCount());
         ImGui::Text("Triangles: %zu", objChunkManager.GetUploadedTriaCount());
+        ImGui::Text("Meshing: %.3f ms / chunk", objChunkManager.GetAverageMeshingMs());
+        ImGui::Text("Mesh LOD Chunks (1x/2x/4x/8x): %zu / %zu / %zu / %zu",
+                    objChunkManager.GetMeshLodChunkCount(0),
+                    objChunkManager.GetMeshLodChunkCount(1),
+                    objChunkManager.GetMeshLodChunkCount(2),
+                    objChunkManager.GetMeshLodChunkCount(3));
+        ImGui::Text("Meshing Jobs In Flight: %zu", objChunkManager.GetPendingMeshCount());
+        ImGui::Text("Pending Uploads: %zu", objChunkManager.GetPendingUploadCount());
+        ImGui::Text("Last Frame Uploads: %zu (%.1f KB)",
+                    objChunkManager.GetLastFrameUploadCount(),
+                    static_cast<double>(objChunkManager.GetLastFrameUploadBytes()) / 1024.0);
+        ImGui::Text("Chunk Draws: %d (1 multi-draw call)", m_iChunkDraws);
+        ImGui::Text("Frustum Culling: %.3f ms", m_dCullingMs);
+        ImGui::Text("Occlusion Culling: %d drawn, %d occluded (%.3f ms)",
+                    m_iChunkDraws,
+                    m_iOccludedChunks,
+                    m_dOcclusionMs);
+        ImGui::Text("Front-To-Back Sort: %.3f ms", m_dDrawSortMs);
+        // Samples passing the depth test per screen pixel: 1x when nothing is drawn over
+        const ImGuiIO& objIO = ImGui::GetIO();
+        const double dPixels = static_cast<double>(objIO.DisplaySize.x) *
+                               static_cast<double>(objIO.DisplayFramebufferScale.x) *
+                               static_cast<double>(objIO.DisplaySize.y) *
+                               static_cast<double>(objIO.DisplayFramebufferScale.y);
+        ImGui::Text("Samples Passed: %.2f M (%.2fx screen)",
+                    static_cast<double>(m_uiSamplesPassed) / 1e6,
+                    dPixels > 0.0 ? static_cast<double>(m_uiSamplesPassed) / dPixels : 0.0);
+        if (const Renderer::GeometryArena* pArena = objChunkManager.GetGeometryArena()) {
+            // Chunks refused a range at the size limit are not drawn until a later remesh fits
+            ImGui::Text("Geometry Arena: %.1f / %.1f MB (%zu free ranges, %zu failed)",
+                        static_cast<double>(pArena->GetUsedWords()) * 4.0 / (1024.0 * 1024.0),
+                        static_cast<double>(pArena->GetCapacity()) * 4.0 / (1024.0 * 1024.0),
+                        pArena->GetFreeRangeCount(),
+                        pArena->GetFailedAllocationCount());
+        }
+
+        if (m_bHasMeshingComparison) {
+            ImGui::TextColored(ImVec4(0.0f, 1.0f, 1.0f, 1), "Naive vs Greedy (Loaded Chunks)");
+            ImGui::Text("Vertices: %zu -> %zu",
+                        m_objNaiveMeshing.m_iNbVertices,
+                        m_objGreedyMeshing.m_iNbVertices);
+            ImGui::Text("Triangles: %zu -> %zu",
+                        m_objNaiveMeshing.m_iNbTriangles,
+                        m_objGreedyMeshing.m_iNbTriangles);
+            if (m_objNaiveMeshing.m_iNbTriangles > 0) {
+                const double dRatio = static_cast<double>(m_objGreedyMeshing.m_iNbTriangles) /
+                                      static_cast<double>(m_objNaiveMeshing.m_iNbTriangles);
+                ImGui::Text("Reduction: %.1f%%", 100.0 * (1.0 - dRatio));
+            }
+            ImGui::Text("Meshing Time: %.2f ms -> %.2f ms",
+                        m_objNaiveMeshing.m_dMeshingMs,
+                        m_objGreedyMeshing.m_dMeshingMs);
+        }
     }
     if (ImGui::CollapsingHeader("Physics Engine", ImGuiTreeNodeFlags_DefaultOpen)) {
         if (ImGui::Checkbox("Enable V Sync", &m_bEnableVsycn)) {
@@ -169,6 +255,43 @@ void Application::RenderMetricsUI(App::InputHandler& inputHandler,
         ImGui::TextColored(ImVec4(0.0f, 0.8f, 1.0f, 1.0f), "Decouple Render and Physics");
         ImGui::Text("Physics Steps/Frame: %d", m_iPhysicsSteps);
         ImGui::Text("Accumulator Remainder: %0.2f", m_fAccumulator * 1000.0f);
+        ImGui::Text("Active Thermal Chunks: %d / %zu",
+                    m_iActiveThermalChunks,
+                    objChunkManager.GetChunks().size());
+        const char* arrIntegrators[] = {"Explicit", "Implicit (Backward Euler)", "Crank-Nicolson"};
+        if (ImGui::Combo("Integrator", &m_iThermalIntegrator, arrIntegrators, 3)) {
+            inputHandler.SetThermalIntegrator(m_iThermalIntegrator);
+        }
+        if (ImGui::SliderFloat("Time Scale", &m_fThermalTimeScale, 1.0f, 500.0f, "%.0fx")) {
+            inputHandler.SetThermalTimeScale(m_fThermalTimeScale);
+        }
+        const char* arrStorages[] = {"FP32", "FP16 (half traffic)"};
+        if (ImGui::Combo("Thermal Storage", &m_iThermalStorage, arrStorages, 2)) {
+            inputHandler.SetThermalStorage(m_iThermalStorage);
+        }
+        if (ImGui::Checkbox("Thermal LOD", &m_bEnableThermalLod)) {
+            inputHandler.SetEnableThermalLod(m_bEnableThermalLod);
+        }
+        if (m_bEnableThermalLod) {
+            if (ImGui::SliderInt("Full Res Radius", &m_iThermalLodRadius, 1, 16)) {
+                inputHandler.SetThermalLodRadius(m_iThermalLodRadius);
+            }
+            ImGui::Text("Coarse Thermal Chunks: %d", m_iCoarseThermalChunks);
+        }
+        if (ImGui::Checkbox("Async Thermal (overlap rendering)", &m_bEnableAsyncThermal)) {
+            inputHandler.SetEnableAsyncThermal(m_bEnableAsyncThermal);
+        }
+        ImGui::Text("Thermal Join Wait: %.2f ms", m_fThermalJoinWaitMs);
+        ImGui::Text("Thermal Texture Uploads: %d", m_iThermalTextureUploads);
+        ImGui::Text("Thermal Atlas Slots: %d", m_iThermalAtlasSlots);
+        if (m_iThermalIntegrator != 0)
+            ImGui::Text("PCG Iterations: %d", m_iSolverIterations);
+        for (size_t iThread = 0; iThread < m_vecThermalBusyMs.size(); ++iThread) {
+            ImGui::Text("Thermal Worker %zu: %.2f ms busy, %.2f ms wait",
+                        iThread,
+                        m_vecThermalBusyMs[iThread],
+                        m_vecThermalWaitMs[iThread]);
+        }
     }
     ImGui::End();
 
@@ -5,6 +5,9 @@
 
 #pragma once
 
+#include <cstdint>
+#include <vector>
+
 #include "backends/imgui_impl_glfw.h"
 #include "backends/imgui_impl_opengl3.h"
 #include "imgui.h"
@@ -82,6 +85,31 @@ public:
     float m_fAccumulator = 20.0f;
 
     int m_iPhysicsSteps = 0;
+    int m_iActiveThermalChunks = 0;
+    int m_iThermalIntegrator = 0;
+    int m_iSolverIterations = 0;
+    float m_fThermalTimeScale = 1.0f;
+    int m_iThermalStorage = 0;
+    bool m_bEnableThermalLod = false;
+    int m_iThermalLodRadius = 4;
+    int m_iCoarseThermalChunks = 0;
+    bool m_bEnableAsyncThermal = false;
+    float m_fThermalJoinWaitMs = 0.0f;
+    int m_iThermalTextureUploads = 0;
+    int m_iThermalAtlasSlots = 0;
+    int m_iChunkDraws = 0;
+    double m_dCullingMs = 0.0;
+    int m_iOccludedChunks = 0;
+    double m_dOcclusionMs = 0.0;
+    double m_dDrawSortMs = 0.0;
+    uint64_t m_uiSamplesPassed = 0;
+    // Both meshers over the loaded chunks, measured whenever the meshing setup changes
+    MeshingStats m_objNaiveMeshing;
+    MeshingStats m_objGreedyMeshing;
+    bool m_bHasMeshingComparison = false;
+    const char* m_pcSimdIsa = "Scalar";
+    std::vector<float> m_vecThermalBusyMs;  // Per worker, last update
+    std::vector<float> m_vecThermalWaitMs;
     int m_iMainThreads = 1;
     int m_iThermalThreads = 4;
     int m_iActiveThreads = 4;
@@ -92,10 +120,19 @@ public:
     bool m_bWireframeMode = false;
     bool m_bHardwareCulling = true;
     bool m_bEnableNeighborCulling = true;
+    bool m_bEnableGreedyMeshing = false;
+    int m_iMeshUploadBudgetKB = 512;
+    float m_fMeshUploadBudgetMs = 2.0f;
+    int m_iRenderDistance = 6;
+    bool m_bEnableMeshLod = false;
+    int m_iMeshLodRadius = 4;
     bool m_bFrustumCulling = true;
+    bool m_bOcclusionCulling = true;
+    bool m_bFrontToBack = true;
     bool m_bFlyMode = false;
     bool m_bEnableVsycn = false;
     bool m_bEnableSIMD = true;
+    bool m_bEnableTemporalBlocking = false;
 
 private:
     GLFWwindow* m_pWindow;
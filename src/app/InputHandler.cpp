@@ -4,6 +4,7 @@
  */
 
 #include "InputHandler.h"
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 #include <string>
@@ -205,7 +206,9 @@ Core::Mat4 InputHandler::GetViewProjectionMatrix() {
     Core::Mat4 projection;
     float fAspectRatio = static_cast<float>(m_iScreenWidth) / static_cast<float>(m_iScreenHeight);
     if (App::InputHandler::IsPerspective()) {
-        projection = Core::Mat4::Perspective(GetCamera().GetZoom(), fAspectRatio, 0.1f, 100.0f);
+        // Far enough to reach the edge of the render distance along X and Z
+        const float fFar = std::max(100.0f, static_cast<float>(m_iRenderDistance * CHUNK_SIZE));
+        projection = Core::Mat4::Perspective(GetCamera().GetZoom(), fAspectRatio, 0.1f, fFar);
     } else {
         float fHeight = m_fOrthoSize;
         float fWidth = m_fOrthoSize * fAspectRatio;
@@ -51,11 +51,50 @@ public:
     bool IsSIMDEnabled() const { return m_bEnableSIMD; }
     void SetEnableSIMD(bool bValue) { m_bEnableSIMD = bValue; }
 
+    bool IsTemporalBlockingEnabled() const { return m_bEnableTemporalBlocking; }
+    void SetEnableTemporalBlocking(bool bValue) { m_bEnableTemporalBlocking = bValue; }
+
+    int GetThermalIntegrator() const { return m_iThermalIntegrator; }
+    void SetThermalIntegrator(int iValue) { m_iThermalIntegrator = iValue; }
+
+    float GetThermalTimeScale() const { return m_fThermalTimeScale; }
+    void SetThermalTimeScale(float fValue) { m_fThermalTimeScale = fValue; }
+
+    int GetThermalStorage() const { return m_iThermalStorage; }
+    void SetThermalStorage(int iValue) { m_iThermalStorage = iValue; }
+
+    bool IsThermalLodEnabled() const { return m_bEnableThermalLod; }
+    void SetEnableThermalLod(bool bValue) { m_bEnableThermalLod = bValue; }
+    int GetThermalLodRadius() const { return m_iThermalLodRadius; }
+    void SetThermalLodRadius(int iValue) { m_iThermalLodRadius = iValue; }
+
+    bool IsAsyncThermalEnabled() const { return m_bEnableAsyncThermal; }
+    void SetEnableAsyncThermal(bool bValue) { m_bEnableAsyncThermal = bValue; }
+
     bool IsNeighborCullingEnabled() const { return m_bNeighborCullingEnabled; }
     void SetNeighborCullingEnable(bool bValue) { m_bNeighborCullingEnabled = bValue; }
 
+    bool IsGreedyMeshingEnabled() const { return m_bGreedyMeshingEnabled; }
+    void SetGreedyMeshingEnable(bool bValue) { m_bGreedyMeshingEnabled = bValue; }
+
+    int GetMeshUploadBudgetKB() const { return m_iMeshUploadBudgetKB; }
+    void SetMeshUploadBudgetKB(int iValue) { m_iMeshUploadBudgetKB = iValue; }
+    float GetMeshUploadBudgetMs() const { return m_fMeshUploadBudgetMs; }
+    void SetMeshUploadBudgetMs(float fValue) { m_fMeshUploadBudgetMs = fValue; }
+
+    int GetRenderDistance() const { return m_iRenderDistance; }
+    void SetRenderDistance(int iValue) { m_iRenderDistance = iValue; }
+    bool IsMeshLodEnabled() const { return m_bEnableMeshLod; }
+    void SetEnableMeshLod(bool bValue) { m_bEnableMeshLod = bValue; }
+    int GetMeshLodRadius() const { return m_iMeshLodRadius; }
+    void SetMeshLodRadius(int iValue) { m_iMeshLodRadius = iValue; }
+
     bool IsFrustumCullingEnabled() const { return m_bFrustumCullingEnabled; }
     void SetFrustumCullingEnable(bool bValue) { m_bFrustumCullingEnabled = bValue; }
+    bool IsOcclusionCullingEnabled() const { return m_bOcclusionCullingEnabled; }
+    void SetOcclusionCullingEnable(bool bValue) { m_bOcclusionCullingEnabled = bValue; }
+    bool IsFrontToBackEnabled() const { return m_bFrontToBackEnabled; }
+    void SetFrontToBackEnable(bool bValue) { m_bFrontToBackEnabled = bValue; }
 
     int GetActiveThreads() const { return m_iActiveThreads; }
     void SetActiveThreads(int iCt) { m_iActiveThreads = iCt; }
@@ -100,8 +139,23 @@ private:
     int m_iScreenHeight = 1080;
 
     bool m_bEnableSIMD = true;
+    bool m_bEnableTemporalBlocking = false;
+    int m_iThermalIntegrator = 0;  // ThermalIntegrator
+    float m_fThermalTimeScale = 1.0f;
+    int m_iThermalStorage = 0;  // ThermalStorage
+    bool m_bEnableThermalLod = false;
+    int m_iThermalLodRadius = 4;  // Chunks
+    bool m_bEnableAsyncThermal = false;
     bool m_bNeighborCullingEnabled = true;
+    bool m_bGreedyMeshingEnabled = false;
+    int m_iMeshUploadBudgetKB = 512;  // Per frame
+    float m_fMeshUploadBudgetMs = 2.0f;
+    int m_iRenderDistance = 6;  // Chunks
+    bool m_bEnableMeshLod = false;
+    int m_iMeshLodRadius = 4;  // Chunks
     bool m_bFrustumCullingEnabled = true;
+    bool m_bOcclusionCullingEnabled = true;
+    bool m_bFrontToBackEnabled = true;
     bool m_bPerspective = true;
     bool m_bEscClickedFirstTime = false;
     bool m_bLMBClickedFirstTime = false;
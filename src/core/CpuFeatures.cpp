@@ -0,0 +1,87 @@
+/**
+ * @file CpuFeatures.cpp
+ * @brief CPUID / XGETBV based detection of the supported SIMD level.
+ */
+
+#include "CpuFeatures.h"
+
+#if defined(_MSC_VER)
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+namespace Core {
+
+// ********************************************************************
+SimdIsa CpuFeatures::DetectBestIsa() {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    int arrInfo[4] = {0};
+    __cpuid(arrInfo, 0);
+    const int iMaxLeaf = arrInfo[0];
+
+    __cpuid(arrInfo, 1);
+    const bool bSSE42 = (arrInfo[2] & (1 << 20)) != 0;
+    const bool bFMA = (arrInfo[2] & (1 << 12)) != 0;
+    const bool bF16C = (arrInfo[2] & (1 << 29)) != 0;
+    const bool bOSXSave = (arrInfo[2] & (1 << 27)) != 0;
+    const bool bAVX = (arrInfo[2] & (1 << 28)) != 0;
+
+    bool bAVX2 = false, bAVX512F = false;
+    if (iMaxLeaf >= 7) {
+        __cpuidex(arrInfo, 7, 0);
+        bAVX2 = (arrInfo[1] & (1 << 5)) != 0;
+        bAVX512F = (arrInfo[1] & (1 << 16)) != 0;
+    }
+
+    // The OS must save the YMM (XCR0 bits 1-2) and ZMM/opmask (bits 5-7) state
+    const unsigned long long uiXCR0 = bOSXSave ? _xgetbv(0) : 0;
+    const bool bYmmState = (uiXCR0 & 0x6) == 0x6;
+    const bool bZmmState = (uiXCR0 & 0xE6) == 0xE6;
+
+    // Each level implies the ones below it
+    const bool bAVX2Level = bAVX2 && bAVX && bFMA && bF16C && bYmmState;
+    if (bAVX2Level && bAVX512F && bZmmState)
+        return SimdIsa::AVX512;
+    if (bAVX2Level)
+        return SimdIsa::AVX2;
+    if (bSSE42)
+        return SimdIsa::SSE42;
+    return SimdIsa::SCALAR;
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    // __builtin_cpu_supports also checks that the OS enabled the extended register state
+    __builtin_cpu_init();
+    // Each level implies the ones below it
+    const bool bAVX2 = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") &&
+                       __builtin_cpu_supports("f16c");
+    if (bAVX2 && __builtin_cpu_supports("avx512f"))
+        return SimdIsa::AVX512;
+    if (bAVX2)
+        return SimdIsa::AVX2;
+    if (__builtin_cpu_supports("sse4.2"))
+        return SimdIsa::SSE42;
+    return SimdIsa::SCALAR;
+#else
+    return SimdIsa::SCALAR;
+#endif
+}
+// ********************************************************************
+bool CpuFeatures::IsIsaSupported(SimdIsa eIsa) {
+    static const SimdIsa eBestIsa = DetectBestIsa();
+    return static_cast<int>(eIsa) <= static_cast<int>(eBestIsa);
+}
+// ********************************************************************
+const char* CpuFeatures::GetIsaName(SimdIsa eIsa) {
+    switch (eIsa) {
+        case SimdIsa::AVX512:
+            return "AVX-512F";
+        case SimdIsa::AVX2:
+            return "AVX2 + FMA";
+        case SimdIsa::SSE42:
+            return "SSE4.2";
+        case SimdIsa::SCALAR:
+        default:
+            return "Scalar";
+    }
+}
+
+}  // namespace Core
@@ -0,0 +1,36 @@
+/**
+ * @file CpuFeatures.h
+ * @brief Defines the CpuFeatures class, the runtime CPUID detection shared by every module that
+ * ships instruction-set specific code paths.
+ */
+
+#pragma once
+
+namespace Core {
+
+/**
+ * @brief x86 SIMD levels, in increasing order of width. Each level implies the ones below it.
+ */
+enum class SimdIsa { SCALAR = 0, SSE42, AVX2, AVX512 };
+
+/**
+ * @class CpuFeatures
+ * @brief Static utility class answering which SIMD level this machine can run. ISA-specific code
+ * lives in translation units compiled with that ISA's flags only, and is only ever called after
+ * this check confirmed it.
+ */
+class CpuFeatures {
+public:
+    /**
+     * @brief Widest ISA supported by both the CPU (CPUID) and the OS (saved register state).
+     * The AVX2 level also requires FMA and F16C, which every AVX2 CPU has.
+     */
+    static SimdIsa DetectBestIsa();
+    /**
+     * @brief True if eIsa is at most DetectBestIsa() (detected once, then cached).
+     */
+    static bool IsIsaSupported(SimdIsa eIsa);
+    static const char* GetIsaName(SimdIsa eIsa);
+};
+
+}  // namespace Core
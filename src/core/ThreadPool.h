@@ -50,7 +50,8 @@ public:
             objThread.request_stop();
         }
 
-        // 3. jthreads automatically join here on destruction
+        // 3. Join now: the queue is destroyed before the jthreads would join on their own
+        m_objJThreads.clear();
     }
 
     /**
@@ -18,6 +18,7 @@ constexpr float FIXED_THERMAL_TIME_STEP =
 #include <GLFW/glfw3.h>
 // clang-format on
 
+#include <core/CpuFeatures.h>
 #include <core/MathUtils.h>
 #include <core/Matrix.h>
 
@@ -30,6 +31,7 @@ constexpr float FIXED_THERMAL_TIME_STEP =
 #include "app/Application.h"
 #include "app/InputHandler.h"
 #include "app/InputManager.h"
+#include "physics/ThermalKernels.h"
 #include "physics/ThermalSystem.h"
 #include "renderer/WorldRenderer.h"
 
@@ -96,10 +98,11 @@ int main() {
         Renderer::Shader shader("assets/shaders/vertex_Chunk.glsl",
                                 "assets/shaders/fragment_Chunk.glsl");
         Renderer::PrimitiveRenderer::Init();
+        Renderer::WorldRenderer::Init();
 
         shader.Use();
         shader.SetInt("u_Texture", 0);
-        shader.SetInt("u_ThermalTexture", 1);
+        shader.SetInt("u_ThermalAtlas", 1);
         Renderer::Texture texture("assets/textures/texture_atlas.png");
         texture.Bind(0);
 
@@ -118,6 +121,7 @@ int main() {
         App.m_iMaxRenderingThreads = iRenderingThreads;
         App.m_iActiveThreads = iRenderingThreads;
         ThermalSystem objThermalSystem{iThermalThreads};
+        App.m_pcSimdIsa = Core::CpuFeatures::GetIsaName(objThermalSystem.GetSimdIsa());
         inputHandler.SetActiveThreads(iRenderingThreads);
         objChunkManager.SetActiveThreads(iRenderingThreads);
 
@@ -136,6 +140,13 @@ int main() {
             fAccumulator += fDeltaTime;
 
             Core::Vec3 objCameraPos = inputHandler.GetCamera().GetCameraPosition();
+            objChunkManager.SetUploadBudget(
+                static_cast<size_t>(inputHandler.GetMeshUploadBudgetKB()) * 1024,
+                static_cast<double>(inputHandler.GetMeshUploadBudgetMs()));
+            objChunkManager.SetUploadFrustum(inputHandler.GetViewProjectionMatrix());
+            objChunkManager.SetRenderDistance(inputHandler.GetRenderDistance());
+            objChunkManager.SetEnableMeshLod(inputHandler.IsMeshLodEnabled());
+            objChunkManager.SetMeshLodRadius(inputHandler.GetMeshLodRadius());
             objChunkManager.Update(objCameraPos.x, objCameraPos.z);
 
             // Update Stats
@@ -153,6 +164,15 @@ int main() {
                 App.m_bFrustumCulling = inputHandler.IsFrustumCullingEnabled();
             }
             objThermalSystem.SetEnableSIMD(inputHandler.IsSIMDEnabled());
+            objThermalSystem.SetEnableTemporalBlocking(inputHandler.IsTemporalBlockingEnabled());
+            objThermalSystem.SetIntegrator(
+                static_cast<ThermalIntegrator>(inputHandler.GetThermalIntegrator()));
+            objThermalSystem.SetTimeScale(inputHandler.GetThermalTimeScale());
+            objThermalSystem.SetThermalStorage(
+                static_cast<ThermalStorage>(inputHandler.GetThermalStorage()));
+            objThermalSystem.SetEnableLod(inputHandler.IsThermalLodEnabled());
+            objThermalSystem.SetLodRadius(inputHandler.GetThermalLodRadius());
+            objThermalSystem.SetLodCenter(objCameraPos.x, objCameraPos.z);
             int iPhysicsSteps = 0;
             // Fixed timestep loop for thermal simulation to ensure stability
             while (fAccumulator >= FIXED_THERMAL_TIME_STEP) {
@@ -160,18 +180,54 @@ int main() {
                     inputHandler.GetCamera().SetCameraPosition(Core::Vec3(100.0f, 40.0f, 100.0f));
                 else
                     inputHandler.UpdatePlayerPhysics(FIXED_THERMAL_TIME_STEP, objChunkManager);
-                objThermalSystem.UpdateTemperature(FIXED_THERMAL_TIME_STEP, objChunkManager);
 
                 fAccumulator -= FIXED_THERMAL_TIME_STEP;
                 iPhysicsSteps++;
             }
+            // Thermal is independent of the player, so all fixed steps of this frame are advanced
+            // in one wake-up (same substep sequence, fewer barriers, blockable after hitches)
+            if (iPhysicsSteps > 0) {
+                if (inputHandler.IsAsyncThermalEnabled())
+                    objThermalSystem.BeginUpdate(
+                        FIXED_THERMAL_TIME_STEP, objChunkManager, iPhysicsSteps);
+                else
+                    objThermalSystem.UpdateTemperature(
+                        FIXED_THERMAL_TIME_STEP, objChunkManager, iPhysicsSteps);
+            }
             App.m_iPhysicsSteps = iPhysicsSteps;
             App.m_fAccumulator = fAccumulator;
-            // World Rendering
+            // World Rendering (overlaps an asynchronous thermal update: textures come from the
+            // published snapshots)
             Core::Mat4 viewProjection = inputHandler.GetViewProjectionMatrix();
-            Renderer::WorldRenderer::DrawChunks(
-                objChunkManager, shader, viewProjection, inputHandler.IsFrustumCullingEnabled());
+            Renderer::WorldRenderer::DrawChunks(objChunkManager,
+                                                shader,
+                                                viewProjection,
+                                                inputHandler.IsFrustumCullingEnabled(),
+                                                inputHandler.IsOcclusionCullingEnabled(),
+                                                inputHandler.IsFrontToBackEnabled());
             Renderer::WorldRenderer::DrawAxes(viewProjection);
+            App.m_iThermalTextureUploads = Renderer::WorldRenderer::GetLastThermalUploads();
+            App.m_iThermalAtlasSlots = Renderer::WorldRenderer::GetThermalSlotCount();
+            App.m_iChunkDraws = Renderer::WorldRenderer::GetLastChunkDrawCount();
+            App.m_dCullingMs = Renderer::WorldRenderer::GetLastCullingMs();
+            App.m_iOccludedChunks = Renderer::WorldRenderer::GetLastOccludedChunkCount();
+            App.m_dOcclusionMs = Renderer::WorldRenderer::GetLastOcclusionMs();
+            App.m_dDrawSortMs = Renderer::WorldRenderer::GetLastDrawSortMs();
+            App.m_uiSamplesPassed = Renderer::WorldRenderer::GetLastSamplesPassed();
+
+            // Epoch flip: firing below injects heat, and the next frame may unload chunks
+            objThermalSystem.WaitForUpdate();
+            App.m_iActiveThermalChunks = static_cast<int>(objThermalSystem.GetActiveChunkCount());
+            App.m_iSolverIterations = objThermalSystem.GetLastSolverIterations();
+            App.m_iCoarseThermalChunks = static_cast<int>(objThermalSystem.GetCoarseChunkCount());
+            App.m_vecThermalBusyMs.resize(static_cast<size_t>(objThermalSystem.GetNumThreads()));
+            App.m_vecThermalWaitMs.resize(App.m_vecThermalBusyMs.size());
+            for (int iThread = 0; iThread < objThermalSystem.GetNumThreads(); ++iThread) {
+                const auto& objTiming = objThermalSystem.GetThreadTiming(iThread);
+                App.m_vecThermalBusyMs[iThread] = static_cast<float>(objTiming.m_dBusyMs);
+                App.m_vecThermalWaitMs[iThread] = static_cast<float>(objTiming.m_dWaitMs);
+            }
+            App.m_fThermalJoinWaitMs = static_cast<float>(objThermalSystem.GetLastJoinWaitMs());
 
             RayHit objRayHit =
                 inputHandler.ProcessFirePreviewAndFire(objChunkManager, viewProjection);
@@ -181,8 +237,17 @@ int main() {
             App.RenderHelpUI();
             App.EndImGUIFrame();
 
-            if (inputHandler.IsNeighborCullingEnabled() != objChunkManager.GetNeighborCulling()) {
+            const MeshingMode eMeshingMode =
+                inputHandler.IsGreedyMeshingEnabled() ? MeshingMode::GREEDY : MeshingMode::NAIVE;
+            if (inputHandler.IsNeighborCullingEnabled() != objChunkManager.GetNeighborCulling() ||
+                eMeshingMode != objChunkManager.GetMeshingMode()) {
                 objChunkManager.SetNeighborCulling(inputHandler.IsNeighborCullingEnabled());
+                objChunkManager.SetMeshingMode(eMeshingMode);
+                // Compare both meshers on the same chunks before rebuilding with the new setup
+                App.m_objNaiveMeshing = objChunkManager.MeasureMeshing(MeshingMode::NAIVE);
+                App.m_objGreedyMeshing = objChunkManager.MeasureMeshing(MeshingMode::GREEDY);
+                App.m_bHasMeshingComparison = true;
+                objChunkManager.ResetMeshingTime();
                 objChunkManager.ReloadAllChunks();
             }
             if (inputHandler.GetActiveThreads() != objChunkManager.GetActiveThreads()) {
@@ -193,6 +258,7 @@ int main() {
         }
     }
     App.ShutDownImGUI();
+    Renderer::WorldRenderer::Shutdown();
     Renderer::PrimitiveRenderer::Shutdown();
     glfwTerminate();
 
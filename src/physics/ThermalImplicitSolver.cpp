@@ -0,0 +1,327 @@
+/**
+ * @file ThermalImplicitSolver.cpp
+ * @brief Implementation of the multi-threaded, matrix-free Jacobi-PCG implicit thermal step.
+ */
+
+#include "ThermalImplicitSolver.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <unordered_map>
+#include "../world/Chunk.h"
+#include "ThermalKernels.h"
+#include "ThermalScheduler.h"
+
+namespace {
+constexpr int INTERIOR_ROW = CHUNK_SIZE;
+constexpr int INTERIOR_SLICE = CHUNK_SIZE * CHUNK_HEIGHT;
+constexpr int PADDED_ROW = PADDED_CHUNK_SIZE;
+constexpr int PADDED_SLICE = PADDED_CHUNK_SIZE * PADDED_CHUNK_HEIGHT;
+
+int getPaddedIndex(int iX, int iY, int iZ) {
+    return (iX + 1) + (iY + 1) * PADDED_ROW + (iZ + 1) * PADDED_SLICE;
+}
+}  // namespace
+
+// ********************************************************************
+ThermalImplicitSolver::ThermalImplicitSolver(int iNumThreads)
+    : m_iNumThreads(iNumThreads), m_vecPartials(static_cast<size_t>(iNumThreads)) {}
+// ********************************************************************
+void ThermalImplicitSolver::Prepare(const std::vector<Chunk*>& vecChunks) {
+    // Workspaces only grow, so steady state reuses the same field allocations
+    if (m_vecWorkspaces.size() < vecChunks.size())
+        m_vecWorkspaces.resize(vecChunks.size());
+    m_iNbWorkspaces = static_cast<int>(vecChunks.size());
+
+    std::unordered_map<const Chunk*, const Workspace*> mapWorkspaceOf;
+    for (size_t iIdx = 0; iIdx < vecChunks.size(); ++iIdx) {
+        Workspace& objWorkspace = m_vecWorkspaces[iIdx];
+        objWorkspace.m_pChunk = vecChunks[iIdx];
+        if (objWorkspace.m_vecDirection.empty()) {
+            objWorkspace.m_vecResidual.assign(CHUNK_VOL, 0.0f);
+            objWorkspace.m_vecDirection.assign(PADDED_CHUNK_VOL, 0.0f);
+            objWorkspace.m_vecProduct.assign(PADDED_CHUNK_VOL, 0.0f);
+        }
+        if (vecChunks[iIdx]->GetCurrHalfData() && objWorkspace.m_vecField.empty()) {
+            objWorkspace.m_vecField.assign(PADDED_CHUNK_VOL, 0.0f);
+            objWorkspace.m_vecSolution.assign(PADDED_CHUNK_VOL, 0.0f);
+        }
+        mapWorkspaceOf[vecChunks[iIdx]] = &objWorkspace;
+    }
+
+    for (size_t iIdx = 0; iIdx < vecChunks.size(); ++iIdx) {
+        Workspace& objWorkspace = m_vecWorkspaces[iIdx];
+        for (int iDir = 0; iDir < 6; ++iDir) {
+            const Chunk* pNeighbour =
+                objWorkspace.m_pChunk->GetNeighbour(static_cast<Direction>(iDir));
+            auto itWorkspace = mapWorkspaceOf.find(pNeighbour);
+            objWorkspace.m_pNeighbours[iDir] =
+                itWorkspace != mapWorkspaceOf.end() ? itWorkspace->second : nullptr;
+            // Same boundary rule as Chunk::FillHalo: only a missing neighbour mirrors; a cold one
+            // is a 0 K face whose correction is zero
+            objWorkspace.m_bMirrorFace[iDir] =
+                !pNeighbour && objWorkspace.m_pChunk->IsVonNeumannBC();
+        }
+    }
+}
+// ********************************************************************
+void ThermalImplicitSolver::fillDirectionHalo(Workspace& objWorkspace) const {
+    float* pfP = objWorkspace.m_vecDirection.data();
+
+    // Source of each face: the neighbour's p, our own boundary layer (mirror) or zero (a sleeping
+    // or Dirichlet face, whose correction is zero)
+    auto GetFaceSource = [&](Direction iDir) -> const float* {
+        if (objWorkspace.m_pNeighbours[iDir])
+            return objWorkspace.m_pNeighbours[iDir]->m_vecDirection.data();
+        return objWorkspace.m_bMirrorFace[iDir] ? pfP : nullptr;
+    };
+    auto GetSourceLayer = [&](Direction iDir, int iOwnLayer, int iNeighbourLayer) {
+        return objWorkspace.m_pNeighbours[iDir] ? iNeighbourLayer : iOwnLayer;
+    };
+
+    const float* pfWest = GetFaceSource(Direction::WEST);
+    const float* pfEast = GetFaceSource(Direction::EAST);
+    const int iWestX = GetSourceLayer(Direction::WEST, 0, CHUNK_SIZE - 1);
+    const int iEastX = GetSourceLayer(Direction::EAST, CHUNK_SIZE - 1, 0);
+    for (int iZ = 0; iZ < CHUNK_SIZE; ++iZ) {
+        for (int iY = 0; iY < CHUNK_HEIGHT; ++iY) {
+            pfP[getPaddedIndex(-1, iY, iZ)] =
+                pfWest ? pfWest[getPaddedIndex(iWestX, iY, iZ)] : 0.0f;
+            pfP[getPaddedIndex(CHUNK_SIZE, iY, iZ)] =
+                pfEast ? pfEast[getPaddedIndex(iEastX, iY, iZ)] : 0.0f;
+        }
+    }
+
+    auto CopyRow = [](float* pfDst, const float* pfSrc) {
+        if (pfSrc)
+            std::copy_n(pfSrc, CHUNK_SIZE, pfDst);
+        else
+            std::fill_n(pfDst, CHUNK_SIZE, 0.0f);
+    };
+
+    const float* pfBelow = GetFaceSource(Direction::BELOW);
+    const float* pfAbove = GetFaceSource(Direction::ABOVE);
+    const int iBelowY = GetSourceLayer(Direction::BELOW, 0, CHUNK_HEIGHT - 1);
+    const int iAboveY = GetSourceLayer(Direction::ABOVE, CHUNK_HEIGHT - 1, 0);
+    for (int iZ = 0; iZ < CHUNK_SIZE; ++iZ) {
+        CopyRow(&pfP[getPaddedIndex(0, -1, iZ)],
+                pfBelow ? &pfBelow[getPaddedIndex(0, iBelowY, iZ)] : nullptr);
+        CopyRow(&pfP[getPaddedIndex(0, CHUNK_HEIGHT, iZ)],
+                pfAbove ? &pfAbove[getPaddedIndex(0, iAboveY, iZ)] : nullptr);
+    }
+
+    const float* pfSouth = GetFaceSource(Direction::SOUTH);
+    const float* pfNorth = GetFaceSource(Direction::NORTH);
+    const int iSouthZ = GetSourceLayer(Direction::SOUTH, 0, CHUNK_SIZE - 1);
+    const int iNorthZ = GetSourceLayer(Direction::NORTH, CHUNK_SIZE - 1, 0);
+    for (int iY = 0; iY < CHUNK_HEIGHT; ++iY) {
+        CopyRow(&pfP[getPaddedIndex(0, iY, -1)],
+                pfSouth ? &pfSouth[getPaddedIndex(0, iY, iSouthZ)] : nullptr);
+        CopyRow(&pfP[getPaddedIndex(0, iY, CHUNK_SIZE)],
+                pfNorth ? &pfNorth[getPaddedIndex(0, iY, iNorthZ)] : nullptr);
+    }
+}
+// ********************************************************************
+double ThermalImplicitSolver::sumPartials(double PartialSums::*pdMember) const {
+    double dSum = 0.0;
+    for (const PartialSums& objPartial : m_vecPartials) dSum += objPartial.*pdMember;
+    return dSum;
+}
+// ********************************************************************
+void ThermalImplicitSolver::Solve(int iThreadID,
+                                  float fCoefficient,
+                                  float fTheta,
+                                  bool bUseSIMD,
+                                  std::barrier<>& objBarrier,
+                                  double& dBarrierWaitMs) {
+    // Same contiguous block of the Morton-ordered set as the explicit step
+    const ThreadBlock objBlock =
+        ThermalScheduler::GetThreadBlock(iThreadID, m_iNumThreads, m_iNbWorkspaces);
+    const float fImplicitCoeff = fTheta * fCoefficient;
+    const StencilRange objRange = Chunk::GetInteriorStencilRange();
+    PartialSums& objPartial = m_vecPartials[static_cast<size_t>(iThreadID)];
+
+    auto Sync = [&]() {
+        auto tStart = std::chrono::steady_clock::now();
+        objBarrier.arrive_and_wait();
+        dBarrierWaitMs += std::chrono::duration<double, std::milli>(
+                              std::chrono::steady_clock::now() - tStart)
+                              .count();
+    };
+    auto Sweep = [&](const float* pfSrc, float* pfDst, float fSweepCoeff) {
+        if (bUseSIMD)
+            ThermalKernels::StencilSweep_SIMD(pfSrc, pfDst, objRange, fSweepCoeff);
+        else
+            ThermalKernels::StencilSweep(pfSrc, pfDst, objRange, fSweepCoeff);
+    };
+
+    // Jacobi preconditioner: diag(A) = 1 + theta*c*(6 - mirrored faces touching the cell), since a
+    // mirrored halo cell is the cell itself. Applied row by row: only the row ends differ along X.
+    auto ForEachRow = [&](const Workspace& objWorkspace, auto&& RowFunc) {
+        const bool* pbMirror = objWorkspace.m_bMirrorFace;
+        for (int iZ = 0; iZ < CHUNK_SIZE; ++iZ) {
+            for (int iY = 0; iY < CHUNK_HEIGHT; ++iY) {
+                int iRowMirrors = (iY == 0 && pbMirror[Direction::BELOW]) +
+                                  (iY == CHUNK_HEIGHT - 1 && pbMirror[Direction::ABOVE]) +
+                                  (iZ == 0 && pbMirror[Direction::SOUTH]) +
+                                  (iZ == CHUNK_SIZE - 1 && pbMirror[Direction::NORTH]);
+                auto InvDiag = [&](int iMirrors) {
+                    return 1.0f / (1.0f + fImplicitCoeff * static_cast<float>(6 - iMirrors));
+                };
+                float fInvDiag = InvDiag(iRowMirrors);
+                float fInvDiagWest = InvDiag(iRowMirrors + pbMirror[Direction::WEST]);
+                float fInvDiagEast = InvDiag(iRowMirrors + pbMirror[Direction::EAST]);
+                RowFunc(iY * INTERIOR_ROW + iZ * INTERIOR_SLICE,
+                        getPaddedIndex(0, iY, iZ),
+                        fInvDiag,
+                        fInvDiagWest,
+                        fInvDiagEast);
+            }
+        }
+    };
+    auto GetInvDiag = [](int iX, float fInvDiag, float fInvDiagWest, float fInvDiagEast) {
+        return iX == 0 ? fInvDiagWest : (iX == CHUNK_SIZE - 1 ? fInvDiagEast : fInvDiag);
+    };
+
+    // --- Setup: x0 = T, r0 = c*L*T, p0 = z0 = M^-1 r0 ---
+    objPartial.m_dRZ = 0.0;
+    objPartial.m_dRR = 0.0;
+    for (int iIdx = objBlock.m_iBegin; iIdx < objBlock.m_iEnd; ++iIdx) {
+        Workspace& objWorkspace = m_vecWorkspaces[static_cast<size_t>(iIdx)];
+        Chunk* pChunk = objWorkspace.m_pChunk;
+        pChunk->FillHalo();
+        if (const HalfFloat* puiCurr = pChunk->GetCurrHalfData()) {
+            ThermalKernels::ConvertToFloat(
+                puiCurr, objWorkspace.m_vecField.data(), PADDED_CHUNK_VOL);
+            objWorkspace.m_pfCurr = objWorkspace.m_vecField.data();
+            objWorkspace.m_pfNext = objWorkspace.m_vecSolution.data();
+        } else {
+            objWorkspace.m_pfCurr = pChunk->GetCurrData();
+            objWorkspace.m_pfNext = pChunk->GetNextData();
+        }
+        const float* pfCurr = objWorkspace.m_pfCurr;
+        float* pfNext = objWorkspace.m_pfNext;
+        float* pfR = objWorkspace.m_vecResidual.data();
+        float* pfP = objWorkspace.m_vecDirection.data();
+        float* pfQ = objWorkspace.m_vecProduct.data();
+        Sweep(pfCurr, pfQ, fCoefficient);  // q = T + c*L*T
+
+        ForEachRow(objWorkspace, [&](int iRow, int iPadRow, float fD, float fDW, float fDE) {
+            for (int iX = 0; iX < CHUNK_SIZE; ++iX) {
+                float fR = pfQ[iPadRow + iX] - pfCurr[iPadRow + iX];
+                float fZ = fR * GetInvDiag(iX, fD, fDW, fDE);
+                pfR[iRow + iX] = fR;
+                pfP[iPadRow + iX] = fZ;
+                pfNext[iPadRow + iX] = pfCurr[iPadRow + iX];
+                objPartial.m_dRZ += static_cast<double>(fR) * fZ;
+                objPartial.m_dRR += static_cast<double>(fR) * fR;
+            }
+        });
+    }
+    Sync();
+
+    // Every worker reduces the same partials in the same order, so all take identical decisions
+    double dRZ = sumPartials(&PartialSums::m_dRZ);
+    const double dInitialRR = sumPartials(&PartialSums::m_dRR);
+    const double dTargetRR = dInitialRR * RELATIVE_TOLERANCE * RELATIVE_TOLERANCE;
+    double dRR = dInitialRR;
+    int iIteration = 0;
+
+    while (dRR > dTargetRR && iIteration < MAX_ITERATIONS) {
+        // --- q = A*p ---
+        objPartial.m_dPQ = 0.0;
+        for (int iIdx = objBlock.m_iBegin; iIdx < objBlock.m_iEnd; ++iIdx) {
+            Workspace& objWorkspace = m_vecWorkspaces[static_cast<size_t>(iIdx)];
+            fillDirectionHalo(objWorkspace);
+            const float* pfP = objWorkspace.m_vecDirection.data();
+            float* pfQ = objWorkspace.m_vecProduct.data();
+            Sweep(pfP, pfQ, -fImplicitCoeff);  // q = p - theta*c*L*p
+
+            ForEachRow(objWorkspace, [&](int, int iPadRow, float, float, float) {
+                for (int iX = 0; iX < CHUNK_SIZE; ++iX)
+                    objPartial.m_dPQ += static_cast<double>(pfP[iPadRow + iX]) * pfQ[iPadRow + iX];
+            });
+        }
+        Sync();
+
+        const double dPQ = sumPartials(&PartialSums::m_dPQ);
+        if (dPQ <= 0.0)
+            break;
+        const float fAlpha = static_cast<float>(dRZ / dPQ);
+
+        // --- x += alpha*p, r -= alpha*q, z = M^-1 r ---
+        objPartial.m_dRZ = 0.0;
+        objPartial.m_dRR = 0.0;
+        for (int iIdx = objBlock.m_iBegin; iIdx < objBlock.m_iEnd; ++iIdx) {
+            Workspace& objWorkspace = m_vecWorkspaces[static_cast<size_t>(iIdx)];
+            float* pfNext = objWorkspace.m_pfNext;
+            float* pfR = objWorkspace.m_vecResidual.data();
+            const float* pfP = objWorkspace.m_vecDirection.data();
+            const float* pfQ = objWorkspace.m_vecProduct.data();
+
+            ForEachRow(objWorkspace, [&](int iRow, int iPadRow, float fD, float fDW, float fDE) {
+                for (int iX = 0; iX < CHUNK_SIZE; ++iX) {
+                    pfNext[iPadRow + iX] += fAlpha * pfP[iPadRow + iX];
+                    float fR = pfR[iRow + iX] - fAlpha * pfQ[iPadRow + iX];
+                    pfR[iRow + iX] = fR;
+                    objPartial.m_dRZ += static_cast<double>(fR) * fR * GetInvDiag(iX, fD, fDW, fDE);
+                    objPartial.m_dRR += static_cast<double>(fR) * fR;
+                }
+            });
+        }
+        Sync();
+
+        const double dNewRZ = sumPartials(&PartialSums::m_dRZ);
+        dRR = sumPartials(&PartialSums::m_dRR);
+        ++iIteration;
+        if (dRR <= dTargetRR || iIteration >= MAX_ITERATIONS)
+            break;
+
+        // --- p = z + beta*p ---
+        const float fBeta = static_cast<float>(dNewRZ / dRZ);
+        dRZ = dNewRZ;
+        for (int iIdx = objBlock.m_iBegin; iIdx < objBlock.m_iEnd; ++iIdx) {
+            Workspace& objWorkspace = m_vecWorkspaces[static_cast<size_t>(iIdx)];
+            const float* pfR = objWorkspace.m_vecResidual.data();
+            float* pfP = objWorkspace.m_vecDirection.data();
+
+            ForEachRow(objWorkspace, [&](int iRow, int iPadRow, float fD, float fDW, float fDE) {
+                for (int iX = 0; iX < CHUNK_SIZE; ++iX)
+                    pfP[iPadRow + iX] = pfR[iRow + iX] * GetInvDiag(iX, fD, fDW, fDE) +
+                                        fBeta * pfP[iPadRow + iX];
+            });
+        }
+        // Neighbours read our p interior in the next halo exchange
+        Sync();
+    }
+
+    // Store T' of FP16 chunks (reading the rounded values back), then the sleep bookkeeping: the
+    // step's largest change per chunk
+    for (int iIdx = objBlock.m_iBegin; iIdx < objBlock.m_iEnd; ++iIdx) {
+        Workspace& objWorkspace = m_vecWorkspaces[static_cast<size_t>(iIdx)];
+        Chunk* pChunk = objWorkspace.m_pChunk;
+        const float* pfCurr = objWorkspace.m_pfCurr;
+        float* pfNext = objWorkspace.m_pfNext;
+        if (HalfFloat* puiNext = pChunk->GetNextHalfData()) {
+            for (int iZ = 0; iZ < CHUNK_SIZE; ++iZ) {
+                for (int iY = 0; iY < CHUNK_HEIGHT; ++iY) {
+                    const int iPadRow = getPaddedIndex(0, iY, iZ);
+                    ThermalKernels::ConvertToHalf(&pfNext[iPadRow], &puiNext[iPadRow], CHUNK_SIZE);
+                    ThermalKernels::ConvertToFloat(&puiNext[iPadRow], &pfNext[iPadRow], CHUNK_SIZE);
+                }
+            }
+        }
+        float fMaxDelta = 0.0f;
+        for (int iZ = 0; iZ < CHUNK_SIZE; ++iZ)
+            for (int iY = 0; iY < CHUNK_HEIGHT; ++iY)
+                for (int iX = 0, iPad = getPaddedIndex(0, iY, iZ); iX < CHUNK_SIZE; ++iX, ++iPad)
+                    fMaxDelta = std::max(fMaxDelta, std::fabs(pfNext[iPad] - pfCurr[iPad]));
+        pChunk->SetLastMaxDelta(fMaxDelta);
+    }
+
+    if (iThreadID == 0) {
+        m_iLastIterationCount = iIteration;
+        m_dLastRelativeResidual = dInitialRR > 0.0 ? std::sqrt(dRR / dInitialRR) : 0.0;
+    }
+}
+// ********************************************************************
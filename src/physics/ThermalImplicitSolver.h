@@ -0,0 +1,89 @@
+/**
+ * @file ThermalImplicitSolver.h
+ * @brief Defines the matrix-free preconditioned conjugate-gradient solver for implicit heat
+ * diffusion steps across the chunk graph.
+ */
+
+#pragma once
+
+#include <barrier>
+#include <vector>
+
+class Chunk;
+// ********************************************************************
+
+/**
+ * @class ThermalImplicitSolver
+ * @brief Solves one theta-scheme step (I - theta*c*L) T' = (I + (1 - theta)*c*L) T with Jacobi
+ * preconditioned CG, where c = alpha*dt and L is the 7-point Laplacian over all active chunks.
+ * theta = 1 is backward Euler, theta = 0.5 is Crank-Nicolson; both are unconditionally stable.
+ *
+ * The solve runs on the correction e = T' - T, whose right-hand side reduces to c*L*T for any
+ * theta. The operator is never assembled: A*p is the explicit stencil with coefficient -theta*c
+ * applied to the padded p fields, so the scalar and SIMD kernels are reused. Faces towards linked
+ * chunks that are not being solved (sleeping) hold their temperature, i.e. e = 0 across them.
+ * FP16 chunks are solved on FP32 copies of their fields and rounded once when T' is stored.
+ */
+class ThermalImplicitSolver {
+public:
+    static constexpr int MAX_ITERATIONS = 64;
+    static constexpr double RELATIVE_TOLERANCE = 1e-5;
+
+    explicit ThermalImplicitSolver(int iNumThreads);
+
+    /**
+     * @brief Main thread, before waking the workers: binds one workspace to each chunk to solve
+     * and resolves the face links between them.
+     */
+    void Prepare(const std::vector<Chunk*>& vecChunks);
+
+    /**
+     * @brief Called by every worker (iThreadID in [0, iNumThreads)) with the same arguments.
+     * Writes T' into each chunk's next buffer; the caller swaps as after an explicit step.
+     * Each worker owns the contiguous block ThermalScheduler::GetThreadBlock of the chunks given
+     * to Prepare.
+     * @param objBarrier Barrier shared by exactly the iNumThreads workers.
+     * @param dBarrierWaitMs Incremented by the time this worker spent waiting on objBarrier.
+     */
+    void Solve(int iThreadID,
+               float fCoefficient,
+               float fTheta,
+               bool bUseSIMD,
+               std::barrier<>& objBarrier,
+               double& dBarrierWaitMs);
+
+    int GetLastIterationCount() const { return m_iLastIterationCount; }
+    double GetLastRelativeResidual() const { return m_dLastRelativeResidual; }
+
+private:
+    struct Workspace {
+        Chunk* m_pChunk = nullptr;
+        std::vector<float> m_vecResidual;   // r (interior only)
+        std::vector<float> m_vecDirection;  // p (padded, halo exchanged every iteration)
+        std::vector<float> m_vecProduct;    // A*p (padded scratch)
+        std::vector<float> m_vecField;      // T (padded FP32 copy, FP16 chunks only)
+        std::vector<float> m_vecSolution;   // T' (padded, FP16 chunks only)
+        const float* m_pfCurr = nullptr;    // T and T' in FP32, resolved at the start of Solve
+        float* m_pfNext = nullptr;
+        const Workspace* m_pNeighbours[6] = {nullptr};
+        bool m_bMirrorFace[6] = {false};
+    };
+
+    // Per-thread dot product partials on their own cache line. r.z and r.r are written in a
+    // different phase than p.q, so no slot is rewritten while another worker still reads it.
+    struct alignas(64) PartialSums {
+        double m_dRZ = 0.0;
+        double m_dRR = 0.0;
+        double m_dPQ = 0.0;
+    };
+
+    void fillDirectionHalo(Workspace& objWorkspace) const;
+    double sumPartials(double PartialSums::*pdMember) const;
+
+    int m_iNumThreads;
+    std::vector<Workspace> m_vecWorkspaces;
+    int m_iNbWorkspaces = 0;
+    std::vector<PartialSums> m_vecPartials;
+    int m_iLastIterationCount = 0;
+    double m_dLastRelativeResidual = 0.0;
+};
@@ -0,0 +1,179 @@
+/**
+ * @file ThermalKernels.cpp
+ * @brief Scalar 7-point diffusion stencil and the runtime ISA dispatch.
+ */
+
+#include "ThermalKernels.h"
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cmath>
+
+namespace {
+std::atomic<Core::SimdIsa> s_eSelectedIsa{Core::CpuFeatures::DetectBestIsa()};
+std::atomic<StencilSweepFn> s_pfnSelectedSweep{
+    ThermalKernels::GetStencilSweep(s_eSelectedIsa.load())};
+
+bool useF16C() {
+    return static_cast<int>(s_eSelectedIsa.load(std::memory_order_relaxed)) >=
+           static_cast<int>(Core::SimdIsa::AVX2);
+}
+}  // namespace
+
+// ********************************************************************
+float ThermalKernels::StencilSweep(const float* pfSrc,
+                                   float* pfDst,
+                                   const StencilRange& objRange,
+                                   float fCoefficient) {
+    const int iOffsetY = objRange.m_iStrideY;
+    const int iOffsetZ = objRange.m_iStrideZ;
+    float fMaxDelta = 0.0f;
+
+    for (int iZ = objRange.m_iBeginZ; iZ < objRange.m_iEndZ; ++iZ) {
+        for (int iY = objRange.m_iBeginY; iY < objRange.m_iEndY; ++iY) {
+            int iIndex = objRange.m_iBeginX + iY * iOffsetY + iZ * iOffsetZ;
+            for (int iX = objRange.m_iBeginX; iX < objRange.m_iEndX; ++iX, ++iIndex) {
+                float fCurrentTemp = pfSrc[iIndex];
+                float fNeighborSum = pfSrc[iIndex - 1] + pfSrc[iIndex + 1] +
+                                     pfSrc[iIndex - iOffsetY] + pfSrc[iIndex + iOffsetY] +
+                                     pfSrc[iIndex - iOffsetZ] + pfSrc[iIndex + iOffsetZ];
+                float fDelta = fCoefficient * (fNeighborSum - 6.0f * fCurrentTemp);
+                pfDst[iIndex] = fCurrentTemp + fDelta;
+                fMaxDelta = std::max(fMaxDelta, std::fabs(fDelta));
+            }
+        }
+    }
+    return fMaxDelta;
+}
+// ********************************************************************
+float ThermalKernels::StencilSweep_SIMD(const float* pfSrc,
+                                        float* pfDst,
+                                        const StencilRange& objRange,
+                                        float fCoefficient) {
+    return s_pfnSelectedSweep.load(std::memory_order_relaxed)(
+        pfSrc, pfDst, objRange, fCoefficient);
+}
+// ********************************************************************
+float ThermalKernels::StencilSweep_F16(const HalfFloat* puiSrc,
+                                       HalfFloat* puiDst,
+                                       const StencilRange& objRange,
+                                       float fCoefficient) {
+    const int iOffsetY = objRange.m_iStrideY;
+    const int iOffsetZ = objRange.m_iStrideZ;
+    float fMaxDelta = 0.0f;
+    auto Load = [puiSrc](int iIndex) { return HalfToFloat(puiSrc[iIndex]); };
+
+    for (int iZ = objRange.m_iBeginZ; iZ < objRange.m_iEndZ; ++iZ) {
+        for (int iY = objRange.m_iBeginY; iY < objRange.m_iEndY; ++iY) {
+            int iIndex = objRange.m_iBeginX + iY * iOffsetY + iZ * iOffsetZ;
+            for (int iX = objRange.m_iBeginX; iX < objRange.m_iEndX; ++iX, ++iIndex) {
+                float fCurrentTemp = Load(iIndex);
+                float fNeighborSum = Load(iIndex - 1) + Load(iIndex + 1) + Load(iIndex - iOffsetY) +
+                                     Load(iIndex + iOffsetY) + Load(iIndex - iOffsetZ) +
+                                     Load(iIndex + iOffsetZ);
+                float fDelta = fCoefficient * (fNeighborSum - 6.0f * fCurrentTemp);
+                HalfFloat uiNext = FloatToHalf(fCurrentTemp + fDelta);
+                puiDst[iIndex] = uiNext;
+                fMaxDelta = std::max(fMaxDelta, std::fabs(HalfToFloat(uiNext) - fCurrentTemp));
+            }
+        }
+    }
+    return fMaxDelta;
+}
+// ********************************************************************
+float ThermalKernels::StencilSweep_F16_SIMD(const HalfFloat* puiSrc,
+                                            HalfFloat* puiDst,
+                                            const StencilRange& objRange,
+                                            float fCoefficient) {
+    if (useF16C())
+        return StencilSweep_F16_AVX2(puiSrc, puiDst, objRange, fCoefficient);
+    return StencilSweep_F16(puiSrc, puiDst, objRange, fCoefficient);
+}
+// ********************************************************************
+float ThermalKernels::HalfToFloat(HalfFloat uiHalf) {
+    // Shift exponent and mantissa into place and rebias; subnormals are renormalised by a float
+    // subtraction, Inf/NaN get the remaining exponent adjustment
+    constexpr uint32_t SHIFTED_EXP = 0x7C00u << 13;
+    uint32_t uiBits = (static_cast<uint32_t>(uiHalf) & 0x7FFFu) << 13;
+    const uint32_t uiExp = uiBits & SHIFTED_EXP;
+    uiBits += (127u - 15u) << 23;
+    if (uiExp == SHIFTED_EXP) {
+        uiBits += (128u - 16u) << 23;
+    } else if (uiExp == 0) {
+        uiBits += 1u << 23;
+        uiBits = std::bit_cast<uint32_t>(std::bit_cast<float>(uiBits) -
+                                         std::bit_cast<float>(113u << 23));
+    }
+    uiBits |= (static_cast<uint32_t>(uiHalf) & 0x8000u) << 16;
+    return std::bit_cast<float>(uiBits);
+}
+// ********************************************************************
+HalfFloat ThermalKernels::FloatToHalf(float fValue) {
+    constexpr uint32_t F32_INFINITY = 255u << 23;
+    constexpr uint32_t F16_OVERFLOW = (127u + 16u) << 23;
+    constexpr uint32_t DENORM_MAGIC = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+
+    uint32_t uiBits = std::bit_cast<uint32_t>(fValue);
+    const uint32_t uiSign = uiBits & 0x80000000u;
+    uiBits ^= uiSign;
+
+    uint32_t uiHalf;
+    if (uiBits >= F16_OVERFLOW) {
+        uiHalf = uiBits > F32_INFINITY ? 0x7E00u : 0x7C00u;  // NaN stays NaN, the rest is Inf
+    } else if (uiBits < (113u << 23)) {
+        // Subnormal or zero: adding the magic value aligns the 10 mantissa bits at the bottom and
+        // lets the FPU round to nearest even
+        float fAligned = std::bit_cast<float>(uiBits) + std::bit_cast<float>(DENORM_MAGIC);
+        uiHalf = std::bit_cast<uint32_t>(fAligned) - DENORM_MAGIC;
+    } else {
+        const uint32_t uiMantissaOdd = (uiBits >> 13) & 1u;
+        uiBits += ((15u - 127u) << 23) + 0xFFFu;  // Rebias, round half down...
+        uiBits += uiMantissaOdd;                  // ...or half up when that makes it even
+        uiHalf = uiBits >> 13;
+    }
+    return static_cast<HalfFloat>(uiHalf | (uiSign >> 16));
+}
+// ********************************************************************
+void ThermalKernels::ConvertToFloat(const HalfFloat* puiSrc, float* pfDst, int iCount) {
+    if (useF16C()) {
+        ConvertToFloat_F16C(puiSrc, pfDst, iCount);
+        return;
+    }
+    for (int iIdx = 0; iIdx < iCount; ++iIdx) pfDst[iIdx] = HalfToFloat(puiSrc[iIdx]);
+}
+// ********************************************************************
+void ThermalKernels::ConvertToHalf(const float* pfSrc, HalfFloat* puiDst, int iCount) {
+    if (useF16C()) {
+        ConvertToHalf_F16C(pfSrc, puiDst, iCount);
+        return;
+    }
+    for (int iIdx = 0; iIdx < iCount; ++iIdx) puiDst[iIdx] = FloatToHalf(pfSrc[iIdx]);
+}
+// ********************************************************************
+Core::SimdIsa ThermalKernels::SelectIsa(Core::SimdIsa eIsa) {
+    Core::SimdIsa eBestIsa = Core::CpuFeatures::DetectBestIsa();
+    if (static_cast<int>(eIsa) > static_cast<int>(eBestIsa))
+        eIsa = eBestIsa;
+    s_pfnSelectedSweep.store(GetStencilSweep(eIsa));
+    s_eSelectedIsa.store(eIsa);
+    return eIsa;
+}
+// ********************************************************************
+Core::SimdIsa ThermalKernels::GetSelectedIsa() {
+    return s_eSelectedIsa.load();
+}
+// ********************************************************************
+StencilSweepFn ThermalKernels::GetStencilSweep(Core::SimdIsa eIsa) {
+    switch (eIsa) {
+        case Core::SimdIsa::AVX512:
+            return &ThermalKernels::StencilSweep_AVX512;
+        case Core::SimdIsa::AVX2:
+            return &ThermalKernels::StencilSweep_AVX2;
+        case Core::SimdIsa::SSE42:
+            return &ThermalKernels::StencilSweep_SSE42;
+        case Core::SimdIsa::SCALAR:
+        default:
+            return &ThermalKernels::StencilSweep;
+    }
+}
+// ********************************************************************
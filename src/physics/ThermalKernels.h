@@ -0,0 +1,144 @@
+/**
+ * @file ThermalKernels.h
+ * @brief Defines the 7-point heat diffusion stencil kernels shared by the chunk and tile solvers,
+ * with one build per instruction set and a runtime dispatch on the detected ISA.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include "../core/CpuFeatures.h"
+
+/**
+ * @struct StencilRange
+ * @brief Cell range [Begin, End) per axis of an X-contiguous field with padded Y/Z strides.
+ * The caller guarantees one valid ghost cell around the range on every axis.
+ */
+struct StencilRange {
+    int m_iStrideY{0};
+    int m_iStrideZ{0};
+    int m_iBeginX{0}, m_iEndX{0};
+    int m_iBeginY{0}, m_iEndY{0};
+    int m_iBeginZ{0}, m_iEndZ{0};
+};
+
+using StencilSweepFn = float (*)(const float* pfSrc,
+                                 float* pfDst,
+                                 const StencilRange& objRange,
+                                 float fCoefficient);
+
+/**
+ * @brief Raw IEEE 754 binary16 value, as stored by the half-precision thermal fields.
+ */
+using HalfFloat = uint16_t;
+
+/**
+ * @brief Precision of the stored thermal fields. Arithmetic is FP32 either way.
+ */
+enum class ThermalStorage { FP32 = 0, FP16 };
+
+/**
+ * @class ThermalKernels
+ * @brief Static utility class with the explicit diffusion stencil:
+ * next = curr + fCoefficient * (sum(6 neighbours) - 6 * curr).
+ * Every sweep returns max |next - curr| over the range, used to put settled chunks to sleep.
+ *
+ * Each ISA variant lives in its own translation unit compiled with that ISA's flags only
+ * (ThermalKernels_<ISA>.cpp), so the rest of the engine stays baseline x86-64 and a variant is
+ * only ever called after Core::CpuFeatures confirmed it. The F16 kernels use the AVX2 build on
+ * AVX-512 CPUs too.
+ */
+class ThermalKernels {
+public:
+    /**
+     * @brief Scalar reference kernel.
+     */
+    static float StencilSweep(const float* pfSrc,
+                              float* pfDst,
+                              const StencilRange& objRange,
+                              float fCoefficient);
+
+    /**
+     * @brief SSE4.2 kernel, 4 cells per instruction (no FMA) with a scalar tail.
+     */
+    static float StencilSweep_SSE42(const float* pfSrc,
+                                    float* pfDst,
+                                    const StencilRange& objRange,
+                                    float fCoefficient);
+
+    /**
+     * @brief AVX2/FMA kernel, 8 cells per instruction with a scalar tail for ragged rows.
+     * The AVX2 level also requires F16C, which every AVX2 CPU has.
+     */
+    static float StencilSweep_AVX2(const float* pfSrc,
+                                   float* pfDst,
+                                   const StencilRange& objRange,
+                                   float fCoefficient);
+
+    /**
+     * @brief AVX-512F kernel, 16 cells per instruction: one CHUNK_SIZE row per step, ragged rows
+     * finish with a masked load/store instead of a scalar tail.
+     */
+    static float StencilSweep_AVX512(const float* pfSrc,
+                                     float* pfDst,
+                                     const StencilRange& objRange,
+                                     float fCoefficient);
+
+    /**
+     * @brief Runs the kernel of the selected ISA (the widest supported one by default).
+     */
+    static float StencilSweep_SIMD(const float* pfSrc,
+                                   float* pfDst,
+                                   const StencilRange& objRange,
+                                   float fCoefficient);
+
+    // --- Half-precision storage: FP16 in memory, FP32 arithmetic ---
+
+    /**
+     * @brief Same stencil on FP16 fields. Returns max |next - curr| of the stored (rounded)
+     * values, so a cell whose update rounds away counts as settled.
+     */
+    static float StencilSweep_F16(const HalfFloat* puiSrc,
+                                  HalfFloat* puiDst,
+                                  const StencilRange& objRange,
+                                  float fCoefficient);
+
+    /**
+     * @brief AVX2/FMA kernel converting 8 cells at a time with F16C.
+     */
+    static float StencilSweep_F16_AVX2(const HalfFloat* puiSrc,
+                                       HalfFloat* puiDst,
+                                       const StencilRange& objRange,
+                                       float fCoefficient);
+
+    /**
+     * @brief F16C kernel when the selected ISA is AVX2 or wider, scalar otherwise.
+     */
+    static float StencilSweep_F16_SIMD(const HalfFloat* puiSrc,
+                                       HalfFloat* puiDst,
+                                       const StencilRange& objRange,
+                                       float fCoefficient);
+
+    /**
+     * @brief Round-to-nearest-even conversions, bit-identical to F16C.
+     */
+    static float HalfToFloat(HalfFloat uiHalf);
+    static HalfFloat FloatToHalf(float fValue);
+
+    /**
+     * @brief Row conversions, through F16C when the selected ISA allows it.
+     */
+    static void ConvertToFloat(const HalfFloat* puiSrc, float* pfDst, int iCount);
+    static void ConvertToHalf(const float* pfSrc, HalfFloat* puiDst, int iCount);
+    static void ConvertToFloat_F16C(const HalfFloat* puiSrc, float* pfDst, int iCount);
+    static void ConvertToHalf_F16C(const float* pfSrc, HalfFloat* puiDst, int iCount);
+
+    /**
+     * @brief Routes StencilSweep_SIMD to eIsa, clamped to the best supported ISA.
+     * @return The ISA actually selected.
+     */
+    static Core::SimdIsa SelectIsa(Core::SimdIsa eIsa);
+    static Core::SimdIsa GetSelectedIsa();
+
+    static StencilSweepFn GetStencilSweep(Core::SimdIsa eIsa);
+};
@@ -0,0 +1,156 @@
+/**
+ * @file ThermalKernels_AVX2.cpp
+ * @brief AVX2/FMA/F16C build of the 7-point diffusion stencil and the half-precision conversions
+ * (compiled with -mavx2 -mfma -mf16c only here).
+ */
+
+// No std:: templates in this file: their instantiations are shared between translation units at
+// link time and must not come out of the one built for a wider ISA.
+#include <immintrin.h>
+#include "ThermalKernels.h"
+
+// ********************************************************************
+float ThermalKernels::StencilSweep_AVX2(const float* pfSrc,
+                                        float* pfDst,
+                                        const StencilRange& objRange,
+                                        float fCoefficient) {
+    const int iOffsetY = objRange.m_iStrideY;
+    const int iOffsetZ = objRange.m_iStrideZ;
+
+    __m256 vecCoeff = _mm256_set1_ps(fCoefficient);
+    __m256 vecSix = _mm256_set1_ps(6.0f);
+    __m256 vecAbsMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+    __m256 vecMaxDelta = _mm256_setzero_ps();
+    float fMaxDelta = 0.0f;
+
+    for (int iZ = objRange.m_iBeginZ; iZ < objRange.m_iEndZ; ++iZ) {
+        for (int iY = objRange.m_iBeginY; iY < objRange.m_iEndY; ++iY) {
+            int iX = objRange.m_iBeginX;
+            int iIndex = iX + iY * iOffsetY + iZ * iOffsetZ;
+
+            for (; iX + 8 <= objRange.m_iEndX; iX += 8, iIndex += 8) {
+                __m256 curr = _mm256_loadu_ps(&pfSrc[iIndex]);
+
+                __m256 x1 = _mm256_loadu_ps(&pfSrc[iIndex - 1]);
+                __m256 x2 = _mm256_loadu_ps(&pfSrc[iIndex + 1]);
+                __m256 y1 = _mm256_loadu_ps(&pfSrc[iIndex - iOffsetY]);
+                __m256 y2 = _mm256_loadu_ps(&pfSrc[iIndex + iOffsetY]);
+                __m256 z1 = _mm256_loadu_ps(&pfSrc[iIndex - iOffsetZ]);
+                __m256 z2 = _mm256_loadu_ps(&pfSrc[iIndex + iOffsetZ]);
+
+                __m256 neighborSum =
+                    _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(x1, x2), _mm256_add_ps(y1, y2)),
+                                  _mm256_add_ps(z1, z2));
+
+                __m256 delta =
+                    _mm256_mul_ps(vecCoeff, _mm256_fnmadd_ps(vecSix, curr, neighborSum));
+                __m256 next = _mm256_add_ps(curr, delta);
+                vecMaxDelta = _mm256_max_ps(vecMaxDelta, _mm256_and_ps(delta, vecAbsMask));
+
+                _mm256_storeu_ps(&pfDst[iIndex], next);
+            }
+
+            for (; iX < objRange.m_iEndX; ++iX, ++iIndex) {
+                float fCurrentTemp = pfSrc[iIndex];
+                float fNeighborSum = pfSrc[iIndex - 1] + pfSrc[iIndex + 1] +
+                                     pfSrc[iIndex - iOffsetY] + pfSrc[iIndex + iOffsetY] +
+                                     pfSrc[iIndex - iOffsetZ] + pfSrc[iIndex + iOffsetZ];
+                float fDelta = fCoefficient * (fNeighborSum - 6.0f * fCurrentTemp);
+                pfDst[iIndex] = fCurrentTemp + fDelta;
+                float fAbsDelta = fDelta < 0.0f ? -fDelta : fDelta;
+                fMaxDelta = fAbsDelta > fMaxDelta ? fAbsDelta : fMaxDelta;
+            }
+        }
+    }
+
+    alignas(32) float arrLanes[8];
+    _mm256_store_ps(arrLanes, vecMaxDelta);
+    for (float fLane : arrLanes) fMaxDelta = fLane > fMaxDelta ? fLane : fMaxDelta;
+    return fMaxDelta;
+}
+// ********************************************************************
+float ThermalKernels::StencilSweep_F16_AVX2(const HalfFloat* puiSrc,
+                                            HalfFloat* puiDst,
+                                            const StencilRange& objRange,
+                                            float fCoefficient) {
+    const int iOffsetY = objRange.m_iStrideY;
+    const int iOffsetZ = objRange.m_iStrideZ;
+
+    auto Load = [puiSrc](int iIndex) { return HalfToFloat(puiSrc[iIndex]); };
+    auto LoadHalf8 = [](const HalfFloat* puiCells) {
+        return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(puiCells)));
+    };
+
+    __m256 vecCoeff = _mm256_set1_ps(fCoefficient);
+    __m256 vecSix = _mm256_set1_ps(6.0f);
+    __m256 vecAbsMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+    __m256 vecMaxDelta = _mm256_setzero_ps();
+    float fMaxDelta = 0.0f;
+
+    for (int iZ = objRange.m_iBeginZ; iZ < objRange.m_iEndZ; ++iZ) {
+        for (int iY = objRange.m_iBeginY; iY < objRange.m_iEndY; ++iY) {
+            int iX = objRange.m_iBeginX;
+            int iIndex = iX + iY * iOffsetY + iZ * iOffsetZ;
+
+            for (; iX + 8 <= objRange.m_iEndX; iX += 8, iIndex += 8) {
+                __m256 curr = LoadHalf8(&puiSrc[iIndex]);
+
+                __m256 neighborSum = _mm256_add_ps(
+                    _mm256_add_ps(
+                        _mm256_add_ps(LoadHalf8(&puiSrc[iIndex - 1]),
+                                      LoadHalf8(&puiSrc[iIndex + 1])),
+                        _mm256_add_ps(LoadHalf8(&puiSrc[iIndex - iOffsetY]),
+                                      LoadHalf8(&puiSrc[iIndex + iOffsetY]))),
+                    _mm256_add_ps(LoadHalf8(&puiSrc[iIndex - iOffsetZ]),
+                                  LoadHalf8(&puiSrc[iIndex + iOffsetZ])));
+
+                __m256 delta =
+                    _mm256_mul_ps(vecCoeff, _mm256_fnmadd_ps(vecSix, curr, neighborSum));
+                __m256 next = _mm256_add_ps(curr, delta);
+                __m128i packedNext = _mm256_cvtps_ph(next, _MM_FROUND_TO_NEAREST_INT);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(&puiDst[iIndex]), packedNext);
+
+                // Delta of the stored values: an update that rounds away does not keep us awake
+                __m256 storedDelta = _mm256_sub_ps(_mm256_cvtph_ps(packedNext), curr);
+                vecMaxDelta = _mm256_max_ps(vecMaxDelta, _mm256_and_ps(storedDelta, vecAbsMask));
+            }
+
+            for (; iX < objRange.m_iEndX; ++iX, ++iIndex) {
+                float fCurrentTemp = Load(iIndex);
+                float fNeighborSum = Load(iIndex - 1) + Load(iIndex + 1) + Load(iIndex - iOffsetY) +
+                                     Load(iIndex + iOffsetY) + Load(iIndex - iOffsetZ) +
+                                     Load(iIndex + iOffsetZ);
+                HalfFloat uiNext = FloatToHalf(
+                    fCurrentTemp + fCoefficient * (fNeighborSum - 6.0f * fCurrentTemp));
+                puiDst[iIndex] = uiNext;
+                float fAbsDelta = HalfToFloat(uiNext) - fCurrentTemp;
+                fAbsDelta = fAbsDelta < 0.0f ? -fAbsDelta : fAbsDelta;
+                fMaxDelta = fAbsDelta > fMaxDelta ? fAbsDelta : fMaxDelta;
+            }
+        }
+    }
+
+    alignas(32) float arrLanes[8];
+    _mm256_store_ps(arrLanes, vecMaxDelta);
+    for (float fLane : arrLanes) fMaxDelta = fLane > fMaxDelta ? fLane : fMaxDelta;
+    return fMaxDelta;
+}
+// ********************************************************************
+void ThermalKernels::ConvertToFloat_F16C(const HalfFloat* puiSrc, float* pfDst, int iCount) {
+    int iIdx = 0;
+    for (; iIdx + 8 <= iCount; iIdx += 8) {
+        __m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&puiSrc[iIdx]));
+        _mm256_storeu_ps(&pfDst[iIdx], _mm256_cvtph_ps(packed));
+    }
+    for (; iIdx < iCount; ++iIdx) pfDst[iIdx] = HalfToFloat(puiSrc[iIdx]);
+}
+// ********************************************************************
+void ThermalKernels::ConvertToHalf_F16C(const float* pfSrc, HalfFloat* puiDst, int iCount) {
+    int iIdx = 0;
+    for (; iIdx + 8 <= iCount; iIdx += 8) {
+        __m128i packed = _mm256_cvtps_ph(_mm256_loadu_ps(&pfSrc[iIdx]), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&puiDst[iIdx]), packed);
+    }
+    for (; iIdx < iCount; ++iIdx) puiDst[iIdx] = FloatToHalf(pfSrc[iIdx]);
+}
+// ********************************************************************
@@ -0,0 +1,69 @@
+/**
+ * @file ThermalKernels_AVX512.cpp
+ * @brief AVX-512F build of the 7-point diffusion stencil (compiled with -mavx512f only here).
+ */
+
+// No std:: templates in this file: their instantiations are shared between translation units at
+// link time and must not come out of the one built for a wider ISA.
+#include <immintrin.h>
+#include "ThermalKernels.h"
+
+// ********************************************************************
+float ThermalKernels::StencilSweep_AVX512(const float* pfSrc,
+                                          float* pfDst,
+                                          const StencilRange& objRange,
+                                          float fCoefficient) {
+    const int iOffsetY = objRange.m_iStrideY;
+    const int iOffsetZ = objRange.m_iStrideZ;
+
+    __m512 vecCoeff = _mm512_set1_ps(fCoefficient);
+    __m512 vecSix = _mm512_set1_ps(6.0f);
+    __m512 vecMaxDelta = _mm512_setzero_ps();
+
+    for (int iZ = objRange.m_iBeginZ; iZ < objRange.m_iEndZ; ++iZ) {
+        for (int iY = objRange.m_iBeginY; iY < objRange.m_iEndY; ++iY) {
+            int iIndex = objRange.m_iBeginX + iY * iOffsetY + iZ * iOffsetZ;
+
+            // A chunk row is exactly 16 floats: one full-width step. Wider tile rows loop, and the
+            // ragged end is masked so no lane touches memory past the range.
+            for (int iX = objRange.m_iBeginX; iX < objRange.m_iEndX; iX += 16, iIndex += 16) {
+                const int iLanes = objRange.m_iEndX - iX;
+                const __mmask16 uiMask =
+                    iLanes >= 16 ? static_cast<__mmask16>(0xFFFF)
+                                 : static_cast<__mmask16>((1u << iLanes) - 1u);
+
+                __m512 curr = _mm512_maskz_loadu_ps(uiMask, &pfSrc[iIndex]);
+
+                __m512 x1 = _mm512_maskz_loadu_ps(uiMask, &pfSrc[iIndex - 1]);
+                __m512 x2 = _mm512_maskz_loadu_ps(uiMask, &pfSrc[iIndex + 1]);
+                __m512 y1 = _mm512_maskz_loadu_ps(uiMask, &pfSrc[iIndex - iOffsetY]);
+                __m512 y2 = _mm512_maskz_loadu_ps(uiMask, &pfSrc[iIndex + iOffsetY]);
+                __m512 z1 = _mm512_maskz_loadu_ps(uiMask, &pfSrc[iIndex - iOffsetZ]);
+                __m512 z2 = _mm512_maskz_loadu_ps(uiMask, &pfSrc[iIndex + iOffsetZ]);
+
+                __m512 neighborSum =
+                    _mm512_add_ps(_mm512_add_ps(_mm512_add_ps(x1, x2), _mm512_add_ps(y1, y2)),
+                                  _mm512_add_ps(z1, z2));
+
+                __m512 delta =
+                    _mm512_mul_ps(vecCoeff, _mm512_fnmadd_ps(vecSix, curr, neighborSum));
+                __m512 next = _mm512_add_ps(curr, delta);
+                // Masked-off lanes load zeros, so their delta is 0 and cannot raise the maximum
+                // (maskz_max instead of max: the unmasked intrinsic trips GCC's uninitialized
+                // warning through _mm512_undefined_ps)
+                vecMaxDelta = _mm512_maskz_max_ps(static_cast<__mmask16>(0xFFFF), vecMaxDelta,
+                                                  _mm512_abs_ps(delta));
+
+                _mm512_mask_storeu_ps(&pfDst[iIndex], uiMask, next);
+            }
+        }
+    }
+
+    alignas(64) float arrMaxDelta[16];
+    _mm512_store_ps(arrMaxDelta, vecMaxDelta);
+    float fMaxDelta = 0.0f;
+    for (float fLane : arrMaxDelta)
+        fMaxDelta = fLane > fMaxDelta ? fLane : fMaxDelta;
+    return fMaxDelta;
+}
+// ********************************************************************
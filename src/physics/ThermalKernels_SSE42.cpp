@@ -0,0 +1,69 @@
+/**
+ * @file ThermalKernels_SSE42.cpp
+ * @brief SSE4.2 build of the 7-point diffusion stencil (compiled with -msse4.2 only here).
+ */
+
+// No std:: templates in this file: their instantiations are shared between translation units at
+// link time and must not come out of the one built for a wider ISA.
+#include <immintrin.h>
+#include "ThermalKernels.h"
+
+// ********************************************************************
+float ThermalKernels::StencilSweep_SSE42(const float* pfSrc,
+                                         float* pfDst,
+                                         const StencilRange& objRange,
+                                         float fCoefficient) {
+    const int iOffsetY = objRange.m_iStrideY;
+    const int iOffsetZ = objRange.m_iStrideZ;
+
+    __m128 vecCoeff = _mm_set1_ps(fCoefficient);
+    __m128 vecSix = _mm_set1_ps(6.0f);
+    __m128 vecAbsMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+    __m128 vecMaxDelta = _mm_setzero_ps();
+    float fMaxDelta = 0.0f;
+
+    for (int iZ = objRange.m_iBeginZ; iZ < objRange.m_iEndZ; ++iZ) {
+        for (int iY = objRange.m_iBeginY; iY < objRange.m_iEndY; ++iY) {
+            int iX = objRange.m_iBeginX;
+            int iIndex = iX + iY * iOffsetY + iZ * iOffsetZ;
+
+            for (; iX + 4 <= objRange.m_iEndX; iX += 4, iIndex += 4) {
+                __m128 curr = _mm_loadu_ps(&pfSrc[iIndex]);
+
+                __m128 x1 = _mm_loadu_ps(&pfSrc[iIndex - 1]);
+                __m128 x2 = _mm_loadu_ps(&pfSrc[iIndex + 1]);
+                __m128 y1 = _mm_loadu_ps(&pfSrc[iIndex - iOffsetY]);
+                __m128 y2 = _mm_loadu_ps(&pfSrc[iIndex + iOffsetY]);
+                __m128 z1 = _mm_loadu_ps(&pfSrc[iIndex - iOffsetZ]);
+                __m128 z2 = _mm_loadu_ps(&pfSrc[iIndex + iOffsetZ]);
+
+                __m128 neighborSum = _mm_add_ps(_mm_add_ps(_mm_add_ps(x1, x2), _mm_add_ps(y1, y2)),
+                                                _mm_add_ps(z1, z2));
+
+                __m128 delta =
+                    _mm_mul_ps(vecCoeff, _mm_sub_ps(neighborSum, _mm_mul_ps(vecSix, curr)));
+                __m128 next = _mm_add_ps(curr, delta);
+                vecMaxDelta = _mm_max_ps(vecMaxDelta, _mm_and_ps(delta, vecAbsMask));
+
+                _mm_storeu_ps(&pfDst[iIndex], next);
+            }
+
+            for (; iX < objRange.m_iEndX; ++iX, ++iIndex) {
+                float fCurrentTemp = pfSrc[iIndex];
+                float fNeighborSum = pfSrc[iIndex - 1] + pfSrc[iIndex + 1] +
+                                     pfSrc[iIndex - iOffsetY] + pfSrc[iIndex + iOffsetY] +
+                                     pfSrc[iIndex - iOffsetZ] + pfSrc[iIndex + iOffsetZ];
+                float fDelta = fCoefficient * (fNeighborSum - 6.0f * fCurrentTemp);
+                pfDst[iIndex] = fCurrentTemp + fDelta;
+                float fAbsDelta = fDelta < 0.0f ? -fDelta : fDelta;
+                fMaxDelta = fAbsDelta > fMaxDelta ? fAbsDelta : fMaxDelta;
+            }
+        }
+    }
+
+    alignas(16) float arrLanes[4];
+    _mm_store_ps(arrLanes, vecMaxDelta);
+    for (float fLane : arrLanes) fMaxDelta = fLane > fMaxDelta ? fLane : fMaxDelta;
+    return fMaxDelta;
+}
+// ********************************************************************
@@ -0,0 +1,57 @@
+/**
+ * @file ThermalScheduler.h
+ * @brief Defines the spatial ordering and per-thread partitioning of the thermal active set.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @struct ThreadBlock
+ * @brief Contiguous index range [Begin, End) of the active set owned by one worker.
+ */
+struct ThreadBlock {
+    int m_iBegin{0};
+    int m_iEnd{0};
+};
+
+/**
+ * @class ThermalScheduler
+ * @brief Static utility class: chunks are sorted along a Z-order (Morton) curve over their grid
+ * coordinates, then every worker takes one contiguous block. Chunks that are close on the curve
+ * are close in the world, so most halo reads hit chunks stepped by the same worker (same cache)
+ * instead of alternating between workers as with modulo striding.
+ */
+class ThermalScheduler {
+public:
+    /**
+     * @brief Interleaves the low 16 bits of both chunk coordinates (X in the even bits).
+     * Coordinates are biased to unsigned first, so the order stays continuous across zero.
+     */
+    static constexpr uint32_t MortonCode(int iChunkX, int iChunkZ) {
+        return spreadBits(static_cast<uint32_t>(iChunkX) ^ 0x8000u) |
+               (spreadBits(static_cast<uint32_t>(iChunkZ) ^ 0x8000u) << 1);
+    }
+
+    /**
+     * @brief Balanced split of iCount items: block sizes differ by at most one.
+     */
+    static constexpr ThreadBlock GetThreadBlock(int iThreadID, int iNumThreads, int iCount) {
+        ThreadBlock objBlock;
+        const int64_t iTotal = iCount;
+        objBlock.m_iBegin = static_cast<int>(iTotal * iThreadID / iNumThreads);
+        objBlock.m_iEnd = static_cast<int>(iTotal * (iThreadID + 1) / iNumThreads);
+        return objBlock;
+    }
+
+private:
+    static constexpr uint32_t spreadBits(uint32_t uiValue) {
+        uiValue &= 0x0000FFFFu;
+        uiValue = (uiValue | (uiValue << 8)) & 0x00FF00FFu;
+        uiValue = (uiValue | (uiValue << 4)) & 0x0F0F0F0Fu;
+        uiValue = (uiValue | (uiValue << 2)) & 0x33333333u;
+        uiValue = (uiValue | (uiValue << 1)) & 0x55555555u;
+        return uiValue;
+    }
+};
@@ -5,16 +5,46 @@
 
 #include "ThermalSystem.h"
 #include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
 #include "../world/Chunk.h"
 #include "../world/ChunkManager.h"
+#include "ThermalScheduler.h"
+
+namespace {
+constexpr float THERMAL_DIFFUSIVITY = 0.2f;
+constexpr float CELL_SIZE = 1.0f;
+// Using the CFL(Courant-Friedrichs-Lewy) stability condition
+// For 3D explicit diffusion it is: fDeltaTime <= (fDelX^2) / (6 * fAlpha)
+constexpr float MAX_STABLE_DELTA_TIME = (CELL_SIZE * CELL_SIZE) / (6.0f * THERMAL_DIFFUSIVITY);
+
+int getSubStepsPerStep(float fDeltaTime) {
+    return static_cast<int>(std::ceil(fDeltaTime / MAX_STABLE_DELTA_TIME));
+}
+}  // namespace
 
 // ********************************************************************
 ThermalSystem::ThermalSystem(int iNumThreads)
     : m_iNumThreads(iNumThreads),
       m_bIsRunning(true),
       m_bIsSIMDEnabled(true),
+      m_bIsTemporalBlockingEnabled(false),
+      m_iTemporalBlockDepth(4),
+      m_eIntegrator(ThermalIntegrator::EXPLICIT),
+      m_fTimeScale(1.0f),
+      m_eStorage(ThermalStorage::FP32),
+      m_bIsLodEnabled(false),
+      m_iLodRadius(4),
+      m_iLodCenterX(0),
+      m_iLodCenterZ(0),
       m_fCurrDeltaTime(0.0f),
-      m_pCurrChunkManager(nullptr) {
+      m_iCurrNbSteps(0),
+      m_eCurrIntegrator(ThermalIntegrator::EXPLICIT),
+      m_vecThreadTimings(static_cast<size_t>(iNumThreads)),
+      m_objImplicitSolver(iNumThreads) {
+    m_eSimdIsa = ThermalKernels::SelectIsa(Core::CpuFeatures::DetectBestIsa());
+
     int iTotalParticipants = m_iNumThreads + 1;  // +1 for main thread
     m_pStartBarrier = std::make_unique<std::barrier<>>(iTotalParticipants);
 
@@ -27,6 +57,9 @@ ThermalSystem::ThermalSystem(int iNumThreads)
 }
 // ********************************************************************
 ThermalSystem::~ThermalSystem() {
+    // The chunks may already be gone: only release the workers, nothing is retired
+    if (m_bUpdateInFlight)
+        m_pPhase2Barrier->arrive_and_wait();
     m_bIsRunning = false;
     m_pStartBarrier->arrive_and_wait();
     for (auto& thread : m_vecWorkerThreads) {
@@ -36,57 +69,277 @@ ThermalSystem::~ThermalSystem() {
     }
 }
 // ********************************************************************
-void ThermalSystem::UpdateTemperature(float fDeltaTime, ChunkManager& objChunkManager) {
-    m_fCurrDeltaTime = fDeltaTime;
-    m_pCurrChunkManager = &objChunkManager;
+void ThermalSystem::SetLodCenter(float fWorldX, float fWorldZ) {
+    m_iLodCenterX = static_cast<int>(std::floor(fWorldX / static_cast<float>(CHUNK_SIZE)));
+    m_iLodCenterZ = static_cast<int>(std::floor(fWorldZ / static_cast<float>(CHUNK_SIZE)));
+}
+// ********************************************************************
+void ThermalSystem::UpdateTemperature(float fDeltaTime,
+                                      ChunkManager& objChunkManager,
+                                      int iNbSteps) {
+    WaitForUpdate();
+    if (startUpdate(fDeltaTime, objChunkManager, iNbSteps, false))
+        WaitForUpdate();
+}
+// ********************************************************************
+void ThermalSystem::BeginUpdate(float fDeltaTime, ChunkManager& objChunkManager, int iNbSteps) {
+    WaitForUpdate();
+    startUpdate(fDeltaTime, objChunkManager, iNbSteps, true);
+}
+// ********************************************************************
+void ThermalSystem::WaitForUpdate() {
+    if (!m_bUpdateInFlight)
+        return;
+    const auto tStart = std::chrono::steady_clock::now();
+    m_pPhase2Barrier->arrive_and_wait();
+    m_dLastJoinWaitMs =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - tStart)
+            .count();
+    m_bUpdateInFlight = false;
+
+    if (m_bCurrAsync) {
+        for (Chunk* pChunk : m_vecActiveChunks) {
+            pChunk->SetThermalUpdateInFlight(false);
+            pChunk->FlipThermalSnapshot();
+        }
+    }
+    retireSettledChunks();
+    ++m_uiEpoch;
+}
+// ********************************************************************
+bool ThermalSystem::startUpdate(float fDeltaTime,
+                                ChunkManager& objChunkManager,
+                                int iNbSteps,
+                                bool bAsync) {
+    const float fScaledDeltaTime = fDeltaTime * m_fTimeScale;
+    if (fScaledDeltaTime <= 0.0f || iNbSteps <= 0)
+        return false;
+
+    m_bCurrAsync = bAsync;
+    m_fCurrDeltaTime = fScaledDeltaTime;
+    m_iCurrNbSteps = iNbSteps;
+    m_eCurrIntegrator = m_eIntegrator;
+    float fSubStepTime = fScaledDeltaTime;
+    if (m_eCurrIntegrator == ThermalIntegrator::EXPLICIT)
+        fSubStepTime /= static_cast<float>(getSubStepsPerStep(fScaledDeltaTime));
+    buildActiveSet(objChunkManager, fSubStepTime);
+    // Nothing is warm: leave the workers parked on the start barrier
+    if (m_vecActiveChunks.empty()) {
+        std::fill(m_vecThreadTimings.begin(), m_vecThreadTimings.end(), ThreadTiming{});
+        m_dLastJoinWaitMs = 0.0;
+        return false;
+    }
+    if (m_eCurrIntegrator != ThermalIntegrator::EXPLICIT)
+        m_objImplicitSolver.Prepare(m_vecActiveChunks);
+    // Chunks that just became active have nothing published yet: give them a front snapshot
+    // now, before the workers own their live fields (the texture pass skips them otherwise)
+    if (bAsync) {
+        for (Chunk* pChunk : m_vecActiveChunks) {
+            if (!pChunk->HasThermalSnapshot()) {
+                pChunk->PublishThermalSnapshot();
+                pChunk->FlipThermalSnapshot();
+            }
+            pChunk->SetThermalUpdateInFlight(true);
+        }
+    }
 
     m_pStartBarrier->arrive_and_wait();
-    m_pPhase2Barrier->arrive_and_wait();
+    m_bUpdateInFlight = true;
+    return true;
+}
+// ********************************************************************
+void ThermalSystem::buildActiveSet(ChunkManager& objChunkManager, float fSubStepTime) {
+    m_vecActiveChunks.clear();
+    m_iNbCoarseChunks = 0;
+    // Every chunk switches, not only the active ones: halos and the texture pass read neighbours
+    const ThermalStorage eStorage = m_eStorage;
+    for (auto& [coords, pChunk] : objChunkManager.GetMutableChunks()) {
+        pChunk->SetThermalStorage(eStorage);
+        if (!m_bCurrAsync)
+            pChunk->ReleaseThermalSnapshot();
+        if (pChunk->HasThermalData()) {
+            updateThermalLod(*pChunk);
+            if (pChunk->GetThermalLod() > 0)
+                ++m_iNbCoarseChunks;
+        }
+        if (pChunk->IsThermalActive())
+            m_vecActiveChunks.push_back(pChunk.get());
+    }
+
+    // A face is worth crossing when the exchange it drives would keep the neighbour awake anyway
+    const float fCoefficient = THERMAL_DIFFUSIVITY * fSubStepTime;
+    const size_t iNbAwake = m_vecActiveChunks.size();
+    for (size_t iIdx = 0; iIdx < iNbAwake; ++iIdx) {
+        Chunk* pChunk = m_vecActiveChunks[iIdx];
+        for (int iDir = 0; iDir < 6; ++iDir) {
+            Chunk* pNeighbour = pChunk->GetNeighbour(static_cast<Direction>(iDir));
+            if (!pNeighbour || pNeighbour->IsThermalActive())
+                continue;
+            float fFaceDiff = pChunk->GetMaxFaceDifference(static_cast<Direction>(iDir));
+            if (fCoefficient * fFaceDiff > THERMAL_SLEEP_DELTA) {
+                pNeighbour->WakeThermal();
+                m_vecActiveChunks.push_back(pNeighbour);
+            }
+        }
+    }
+
+    // Map iteration order is row-major and woken neighbours land at the end: re-sort so that
+    // contiguous blocks are compact 2D regions
+    m_vecSortKeys.clear();
+    for (Chunk* pChunk : m_vecActiveChunks) {
+        m_vecSortKeys.emplace_back(
+            ThermalScheduler::MortonCode(pChunk->GetChunkX(), pChunk->GetChunkZ()), pChunk);
+    }
+    std::sort(m_vecSortKeys.begin(), m_vecSortKeys.end(), [](const auto& objA, const auto& objB) {
+        return objA.first < objB.first;
+    });
+    for (size_t iIdx = 0; iIdx < m_vecSortKeys.size(); ++iIdx)
+        m_vecActiveChunks[iIdx] = m_vecSortKeys[iIdx].second;
+}
+// ********************************************************************
+void ThermalSystem::updateThermalLod(Chunk& objChunk) const {
+    int iTargetLod = 0;
+    if (m_bIsLodEnabled && m_eCurrIntegrator == ThermalIntegrator::EXPLICIT) {
+        const int iRadius = std::max(m_iLodRadius.load(), 0);
+        const int iDistance = std::max(std::abs(objChunk.GetChunkX() - m_iLodCenterX),
+                                       std::abs(objChunk.GetChunkZ() - m_iLodCenterZ));
+        iTargetLod = iDistance <= iRadius ? 0 : (iDistance <= 2 * iRadius ? 1 : THERMAL_MAX_LOD);
+    }
+
+    const int iCurrLod = objChunk.GetThermalLod();
+    if (iTargetLod < iCurrLod) {
+        objChunk.SetThermalLod(iTargetLod);
+        return;
+    }
+    if (iTargetLod == iCurrLod || m_uiEpoch < objChunk.GetLodRecheckEpoch())
+        return;
+    // Coarsen as far as the field allows: a sharp front stays resolved until it has spread out
+    for (int iLod = iTargetLod; iLod > iCurrLod; --iLod) {
+        if (objChunk.GetRestrictionError(iLod) <= THERMAL_LOD_TOLERANCE) {
+            objChunk.SetThermalLod(iLod);
+            return;
+        }
+    }
+    // Fronts spread over many steps: no need to measure them again before a few updates
+    objChunk.SetLodRecheckEpoch(m_uiEpoch + THERMAL_LOD_RECHECK_INTERVAL);
+}
+// ********************************************************************
+void ThermalSystem::retireSettledChunks() {
+    for (Chunk* pChunk : m_vecActiveChunks) {
+        pChunk->MarkThermalDirty();
+        for (int iDir = 0; iDir < 6; ++iDir) {
+            Chunk* pNeighbour = pChunk->GetNeighbour(static_cast<Direction>(iDir));
+            if (!pNeighbour)
+                continue;
+            // Active chunks got their halo from the workers; a resting neighbour only needs the
+            // face towards this chunk, but the memcpy fill of all six is cheap enough
+            if (!pNeighbour->IsThermalActive() && pNeighbour->HasThermalData())
+                pNeighbour->FillTextureHalo();
+            pNeighbour->MarkThermalDirty();
+        }
+    }
+    for (Chunk* pChunk : m_vecActiveChunks) {
+        if (pChunk->GetLastMaxDelta() < THERMAL_SLEEP_DELTA)
+            pChunk->SleepThermal();
+    }
 }
 // ********************************************************************
 void ThermalSystem::workerThreadLoop(int iThreadID) {
-    const float fAlpha = 0.2f;
-    const float fDelX = 1.0f;
-    // Using the CFL(Courant-Friedrichs-Lewy) stability condition
-    // For 3D explicit diffusion it is: fDeltaTime <= (fDelX^2) / (6 * fAlpha)
-    const float fMaxDeltaTime = (fDelX * fDelX) / (6.0f * fAlpha);  // CFL Condition
+    const float fAlpha = THERMAL_DIFFUSIVITY;
 
-    while (m_bIsRunning) {
+    // Always rendezvous on the start barrier before testing the running flag, otherwise a worker
+    // that observes shutdown early never arrives and the destructor blocks forever.
+    while (true) {
         m_pStartBarrier->arrive_and_wait();
         if (!m_bIsRunning)
             break;
-        int iNbSteps = 0;
-        float fStepTime = 0.0f;
-        if (m_fCurrDeltaTime > 0.0f) {
-            iNbSteps = static_cast<int>(std::ceil(m_fCurrDeltaTime / fMaxDeltaTime));
-            fStepTime = m_fCurrDeltaTime / static_cast<float>(iNbSteps);
+        const auto tUpdateStart = std::chrono::steady_clock::now();
+        double dWaitMs = 0.0;
+        auto SyncWorkers = [&]() {
+            auto tStart = std::chrono::steady_clock::now();
+            m_pPhase1Barrier->arrive_and_wait();
+            dWaitMs += std::chrono::duration<double, std::milli>(
+                           std::chrono::steady_clock::now() - tStart)
+                           .count();
+        };
+        // Implicit steps are unconditionally stable: one solve per fixed step, no CFL substeps
+        const bool bImplicit = m_eCurrIntegrator != ThermalIntegrator::EXPLICIT;
+        const float fTheta = m_eCurrIntegrator == ThermalIntegrator::CRANK_NICOLSON ? 0.5f : 1.0f;
+        int iNbSteps = m_iCurrNbSteps;
+        float fStepTime = m_fCurrDeltaTime;
+        if (!bImplicit) {
+            int iSubStepsPerStep = getSubStepsPerStep(m_fCurrDeltaTime);
+            iNbSteps = iSubStepsPerStep * m_iCurrNbSteps;
+            fStepTime = m_fCurrDeltaTime / static_cast<float>(iSubStepsPerStep);
         }
-        for (int iStepCt = 0; iStepCt < iNbSteps; iStepCt++) {
-            auto& chunks = m_pCurrChunkManager->GetMutableChunks();
-            int iChunkIndex = 0;
-            for (auto& [coords, pChunk] : chunks) {
-                if (iChunkIndex % m_iNumThreads == iThreadID) {
-                    if (m_bIsSIMDEnabled)
-                        pChunk->ThermalStep_AVX2(fStepTime, fAlpha);
+        // Read once per wake-up so every worker agrees on the pass layout
+        const bool bUseSIMD = m_bIsSIMDEnabled;
+        // The blocked kernel gathers full-resolution tiles: it sits out while any chunk is coarse
+        const int iBlockDepth =
+            m_bIsTemporalBlockingEnabled && m_iNbCoarseChunks == 0
+                ? std::clamp(m_iTemporalBlockDepth.load(), 1, MAX_TEMPORAL_BLOCK_DEPTH)
+                : 1;
+
+        // The active set is fixed for the whole update, and so is this worker's block
+        const ThreadBlock objBlock = ThermalScheduler::GetThreadBlock(
+            iThreadID, m_iNumThreads, static_cast<int>(m_vecActiveChunks.size()));
+
+        for (int iStepCt = 0; iStepCt < iNbSteps;) {
+            const int iPassSteps = bImplicit ? 1 : std::min(iBlockDepth, iNbSteps - iStepCt);
+            if (bImplicit) {
+                m_objImplicitSolver.Solve(iThreadID,
+                                          fAlpha * fStepTime,
+                                          fTheta,
+                                          bUseSIMD,
+                                          *m_pPhase1Barrier,
+                                          dWaitMs);
+            }
+            for (int iChunkIndex = objBlock.m_iBegin; iChunkIndex < objBlock.m_iEnd && !bImplicit;
+                 ++iChunkIndex) {
+                Chunk* pChunk = m_vecActiveChunks[iChunkIndex];
+                if (iPassSteps > 1) {
+                    pChunk->ThermalStep_TemporalBlocked(fAlpha, fStepTime, iPassSteps, bUseSIMD);
+                } else {
+                    // Halo fill only reads the neighbours' interior cells and writes our own
+                    // ring, so it is race-free against other workers stepping their chunks.
+                    pChunk->FillHalo();
+                    if (bUseSIMD)
+                        pChunk->ThermalStep_SIMD(fAlpha, fStepTime);
                     else
-                        pChunk->ThermalStep(fStepTime, fAlpha);
+                        pChunk->ThermalStep(fAlpha, fStepTime);
                 }
-                ++iChunkIndex;
             }
-            m_pPhase1Barrier->arrive_and_wait();
+            SyncWorkers();
 
-            iChunkIndex = 0;
-            for (auto& [coords, pChunk] : chunks) {
-                if (iChunkIndex % m_iNumThreads == iThreadID) {
-                    pChunk->SwapBuffers();
-                }
-                ++iChunkIndex;
-            }
+            for (int iChunkIndex = objBlock.m_iBegin; iChunkIndex < objBlock.m_iEnd; ++iChunkIndex)
+                m_vecActiveChunks[iChunkIndex]->SwapBuffers();
+
+            iStepCt += iPassSteps;
+            if (iStepCt < iNbSteps)
+                SyncWorkers();
+        }
 
-            if (iStepCt < iNbSteps - 1)
-                m_pPhase1Barrier->arrive_and_wait();
+        // Coarse chunks refresh their full-resolution field. Once every worker is done, the
+        // texture halos are rebuilt from the final fields here rather than on the main thread,
+        // and in asynchronous mode every chunk publishes its field to the back snapshot slot
+        // (the renderer may be reading the front one)
+        for (int iChunkIndex = objBlock.m_iBegin; iChunkIndex < objBlock.m_iEnd; ++iChunkIndex)
+            m_vecActiveChunks[iChunkIndex]->ProlongateToFine();
+        SyncWorkers();
+        for (int iChunkIndex = objBlock.m_iBegin; iChunkIndex < objBlock.m_iEnd; ++iChunkIndex) {
+            Chunk* pChunk = m_vecActiveChunks[iChunkIndex];
+            pChunk->FillTextureHalo();
+            if (m_bCurrAsync)
+                pChunk->PublishThermalSnapshot();
         }
 
+        // Published to the main thread by the phase 2 barrier
+        ThreadTiming& objTiming = m_vecThreadTimings[static_cast<size_t>(iThreadID)];
+        const double dTotalMs = std::chrono::duration<double, std::milli>(
+                                    std::chrono::steady_clock::now() - tUpdateStart)
+                                    .count();
+        objTiming.m_dWaitMs = dWaitMs;
+        objTiming.m_dBusyMs = dTotalMs - dWaitMs;
         m_pPhase2Barrier->arrive_and_wait();
     }
 }
@@ -7,41 +7,217 @@
 
 #include <atomic>
 #include <barrier>
+#include <cstdint>
 #include <memory>
 #include <thread>
 #include <vector>
 
+#include "ThermalImplicitSolver.h"
+#include "ThermalKernels.h"
+
+class Chunk;
 class ChunkManager;
 // ********************************************************************
 
+/**
+ * @brief Time integration scheme of the diffusion step.
+ */
+enum class ThermalIntegrator {
+    EXPLICIT = 0,    // Forward Euler, split into CFL-bounded substeps
+    BACKWARD_EULER,  // Implicit, unconditionally stable, one PCG solve per fixed step
+    CRANK_NICOLSON   // Implicit, second order in time, one PCG solve per fixed step
+};
+
 /**
  * @class ThermalSystem
  * @brief Manages a thread pool to compute 3D explicit thermal diffusion across voxel chunks.
+ * Only the active set is stepped: chunks that received heat, plus neighbours woken when heat
+ * crosses a face. Chunks whose field has settled are put back to sleep after each update.
+ * The active set is kept in Morton order and each worker steps one contiguous block of it.
+ * With LOD enabled, chunks far from the player are stepped on a 2x or 4x coarser grid.
+ *
+ * UpdateTemperature blocks until the step is done. BeginUpdate/WaitForUpdate split it so the
+ * workers run while the caller renders: each active chunk publishes its field into a
+ * double-buffered snapshot that the texture pass reads, and WaitForUpdate flips the snapshots.
  */
 class ThermalSystem {
 public:
+    /**
+     * @brief Wall time of one worker over the last update, split into stepping and waiting on
+     * the other workers. Uneven busy times mean the blocks are imbalanced.
+     */
+    struct alignas(64) ThreadTiming {
+        double m_dBusyMs = 0.0;
+        double m_dWaitMs = 0.0;
+    };
+
     ThermalSystem(int iNumThreads);
     ~ThermalSystem();
 
     /**
      * @brief Wakes worker threads to compute the next thermal integration step based on elapsed
      * time.
+     * @param fDeltaTime Duration of one fixed step.
+     * @param iNbSteps Number of consecutive fixed steps to advance in a single wake-up (catch-up
+     * after frame hitches). Each fixed step is still split into its own CFL substeps.
+     */
+    void UpdateTemperature(float fDeltaTime, ChunkManager& objChunkManager, int iNbSteps = 1);
+
+    /**
+     * @brief Asynchronous UpdateTemperature: prepares the update on the calling thread, wakes the
+     * workers and returns. Until WaitForUpdate(), the caller may render (chunk textures come from
+     * the published snapshots) but must not touch thermal fields or the chunk set.
+     */
+    void BeginUpdate(float fDeltaTime, ChunkManager& objChunkManager, int iNbSteps = 1);
+
+    /**
+     * @brief Epoch flip: waits for the workers, swaps the published snapshots and retires the
+     * settled chunks. Returns at once when no update is in flight.
+     */
+    void WaitForUpdate();
+    bool IsUpdateInFlight() const { return m_bUpdateInFlight; }
+
+    /**
+     * @brief Number of completed updates, i.e. of published field generations.
      */
-    void UpdateTemperature(float fDeltaTime, ChunkManager& objChunkManager);
+    uint64_t GetEpoch() const { return m_uiEpoch; }
+
+    /**
+     * @brief Time the caller was blocked on the workers in the last WaitForUpdate (the whole
+     * update in synchronous mode, what rendering did not hide in asynchronous mode).
+     */
+    double GetLastJoinWaitMs() const { return m_dLastJoinWaitMs; }
     void SetEnableSIMD(bool bEnable) { m_bIsSIMDEnabled = bEnable; }
 
+    /**
+     * @brief ISA of the SIMD kernels, picked via CPUID when the system is constructed.
+     */
+    Core::SimdIsa GetSimdIsa() const { return m_eSimdIsa; }
+
+    /**
+     * @brief Enables the temporally blocked kernel, which advances up to the block depth of
+     * substeps per pass over a chunk instead of one substep (and two barriers) per pass.
+     */
+    void SetEnableTemporalBlocking(bool bEnable) { m_bIsTemporalBlockingEnabled = bEnable; }
+    void SetTemporalBlockDepth(int iDepth) { m_iTemporalBlockDepth = iDepth; }
+    int GetTemporalBlockDepth() const { return m_iTemporalBlockDepth; }
+
+    /**
+     * @brief Selects the integrator for the following updates. Implicit modes ignore temporal
+     * blocking and take one solve per fixed step however large the step is.
+     */
+    void SetIntegrator(ThermalIntegrator eIntegrator) { m_eIntegrator = eIntegrator; }
+    ThermalIntegrator GetIntegrator() const { return m_eIntegrator; }
+
+    /**
+     * @brief Simulated seconds per real second (fast-forward). Scales every fixed step, so the
+     * explicit integrator needs proportionally more substeps while the implicit ones do not.
+     */
+    void SetTimeScale(float fTimeScale) { m_fTimeScale = fTimeScale; }
+    float GetTimeScale() const { return m_fTimeScale; }
+
+    /**
+     * @brief Storage precision of every chunk's thermal fields, applied (converting existing
+     * fields) at the start of the next update.
+     */
+    void SetThermalStorage(ThermalStorage eStorage) { m_eStorage = eStorage; }
+    ThermalStorage GetThermalStorage() const { return m_eStorage; }
+
+    /**
+     * @brief Thermal LOD: chunks within iRadius chunks (Chebyshev distance) of the centre run at
+     * full resolution, up to twice that at 2x coarser cells and beyond at 4x. A chunk refines as
+     * soon as it comes back in range (or is heated), but only coarsens while its field is smooth
+     * enough (Chunk::GetRestrictionError). Implicit integrators always run at full resolution.
+     */
+    void SetEnableLod(bool bEnable) { m_bIsLodEnabled = bEnable; }
+    void SetLodRadius(int iRadius) { m_iLodRadius = iRadius; }
+    int GetLodRadius() const { return m_iLodRadius; }
+    void SetLodCenter(float fWorldX, float fWorldZ);
+
+    /**
+     * @brief Chunks holding a coarse field after the last update.
+     */
+    size_t GetCoarseChunkCount() const { return m_iNbCoarseChunks; }
+
+    /**
+     * @brief PCG iterations of the last implicit solve (0 in explicit mode).
+     */
+    int GetLastSolverIterations() const {
+        return m_eCurrIntegrator == ThermalIntegrator::EXPLICIT
+                   ? 0
+                   : m_objImplicitSolver.GetLastIterationCount();
+    }
+
+    /**
+     * @brief Number of chunks stepped by the last update (after wake-ups, before sleeping).
+     */
+    size_t GetActiveChunkCount() const { return m_vecActiveChunks.size(); }
+
+    /**
+     * @brief Read on the main thread between updates.
+     */
+    int GetNumThreads() const { return m_iNumThreads; }
+    const ThreadTiming& GetThreadTiming(int iThreadID) const {
+        return m_vecThreadTimings[static_cast<size_t>(iThreadID)];
+    }
+
 private:
     /**
      * @brief Main execution loop for each worker thread, regulated by barrier synchronization.
      */
     void workerThreadLoop(int iThreadID);
 
+    /**
+     * @brief Shared front half of both update modes.
+     * @return false when nothing is warm and the workers were left parked.
+     */
+    bool startUpdate(float fDeltaTime, ChunkManager& objChunkManager, int iNbSteps, bool bAsync);
+
+    /**
+     * @brief Applies the storage mode, collects the active chunks, wakes the neighbours that heat
+     * is about to cross into and sorts the result along the Morton curve.
+     */
+    void buildActiveSet(ChunkManager& objChunkManager, float fSubStepTime);
+
+    /**
+     * @brief Bumps the thermal generation of the stepped chunks and their neighbours (rebuilding
+     * the texture halo of resting ones) and puts the settled chunks to sleep.
+     */
+    void retireSettledChunks();
+
+    /**
+     * @brief Moves a chunk with thermal data towards the LOD its distance asks for. Refining is
+     * immediate; after a failed coarsening test the chunk waits THERMAL_LOD_RECHECK_INTERVAL
+     * updates before the next one.
+     */
+    void updateThermalLod(Chunk& objChunk) const;
+
     int m_iNumThreads;
     std::atomic<bool> m_bIsRunning;
     std::atomic<bool> m_bIsSIMDEnabled;
+    std::atomic<bool> m_bIsTemporalBlockingEnabled;
+    std::atomic<int> m_iTemporalBlockDepth;
+    std::atomic<ThermalIntegrator> m_eIntegrator;
+    std::atomic<float> m_fTimeScale;
+    std::atomic<ThermalStorage> m_eStorage;
+    std::atomic<bool> m_bIsLodEnabled;
+    std::atomic<int> m_iLodRadius;
+    std::atomic<int> m_iLodCenterX;
+    std::atomic<int> m_iLodCenterZ;
 
     float m_fCurrDeltaTime;
-    ChunkManager* m_pCurrChunkManager;
+    int m_iCurrNbSteps;
+    ThermalIntegrator m_eCurrIntegrator;
+    size_t m_iNbCoarseChunks = 0;
+    bool m_bCurrAsync = false;
+    bool m_bUpdateInFlight = false;
+    uint64_t m_uiEpoch = 0;
+    double m_dLastJoinWaitMs = 0.0;
+    Core::SimdIsa m_eSimdIsa = Core::SimdIsa::SCALAR;
+    std::vector<Chunk*> m_vecActiveChunks;
+    std::vector<std::pair<uint32_t, Chunk*>> m_vecSortKeys;  // Reused Morton sort scratch
+    std::vector<ThreadTiming> m_vecThreadTimings;
+    ThermalImplicitSolver m_objImplicitSolver;
 
     std::unique_ptr<std::barrier<>> m_pStartBarrier;
     std::unique_ptr<std::barrier<>> m_pPhase1Barrier;
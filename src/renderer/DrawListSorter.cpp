@@ -0,0 +1,63 @@
+#include "DrawListSorter.h"
+#include <algorithm>
+#include <utility>
+
+// ********************************************************************
+void DrawListSorter::SortFrontToBack(const BoxArraySoA& objBoxes,
+                                     const Core::Mat4& objViewProjection,
+                                     uint32_t* puiIndices,
+                                     size_t iNbIndices) {
+    if (iNbIndices < 2)
+        return;
+
+    // Clip-space z of each box center (row 2 of the view projection)
+    const float* e = objViewProjection.m_fElements;
+    m_vecDepths.resize(iNbIndices);
+    float fMinDepth = 0.0f, fMaxDepth = 0.0f;
+    for (size_t i = 0; i < iNbIndices; ++i) {
+        const uint32_t uiIndex = puiIndices[i];
+        const float fX = 0.5f * (objBoxes.m_pfMinX[uiIndex] + objBoxes.m_pfMaxX[uiIndex]);
+        const float fY = 0.5f * (objBoxes.m_pfMinY[uiIndex] + objBoxes.m_pfMaxY[uiIndex]);
+        const float fZ = 0.5f * (objBoxes.m_pfMinZ[uiIndex] + objBoxes.m_pfMaxZ[uiIndex]);
+        const float fDepth = e[2] * fX + e[6] * fY + e[10] * fZ + e[14];
+        m_vecDepths[i] = fDepth;
+        fMinDepth = i == 0 ? fDepth : std::min(fMinDepth, fDepth);
+        fMaxDepth = i == 0 ? fDepth : std::max(fMaxDepth, fDepth);
+    }
+    if (!(fMaxDepth > fMinDepth))
+        return;  // One key for all: already in order
+
+    // Quantised over the list's span, both passes' histograms in one sweep
+    constexpr uint32_t KEY_MAX = (1u << KEY_BITS) - 1u;
+    const float fScale = static_cast<float>(KEY_MAX) / (fMaxDepth - fMinDepth);
+    m_vecItems.resize(iNbIndices);
+    m_vecScratch.resize(iNbIndices);
+    size_t arrCounts[KEY_BITS / RADIX_BITS][RADIX_BUCKETS] = {};
+    for (size_t i = 0; i < iNbIndices; ++i) {
+        const auto uiKey =
+            std::min(static_cast<uint32_t>((m_vecDepths[i] - fMinDepth) * fScale), KEY_MAX);
+        m_vecItems[i] = (static_cast<uint64_t>(uiKey) << 32) | puiIndices[i];
+        for (int iPass = 0; iPass < KEY_BITS / RADIX_BITS; ++iPass)
+            ++arrCounts[iPass][(uiKey >> (iPass * RADIX_BITS)) & (RADIX_BUCKETS - 1)];
+    }
+
+    // One stable scatter per digit, least significant first. A digit every key shares leaves
+    // the order as it is and is skipped
+    for (int iPass = 0; iPass < KEY_BITS / RADIX_BITS; ++iPass) {
+        const int iShift = 32 + iPass * RADIX_BITS;
+        size_t* piCounts = arrCounts[iPass];
+        if (piCounts[(m_vecItems[0] >> iShift) & (RADIX_BUCKETS - 1)] == iNbIndices)
+            continue;
+        size_t iOffset = 0;
+        for (int iBucket = 0; iBucket < RADIX_BUCKETS; ++iBucket) {
+            const size_t iCount = piCounts[iBucket];
+            piCounts[iBucket] = iOffset;
+            iOffset += iCount;
+        }
+        for (const uint64_t uiItem : m_vecItems)
+            m_vecScratch[piCounts[(uiItem >> iShift) & (RADIX_BUCKETS - 1)]++] = uiItem;
+        std::swap(m_vecItems, m_vecScratch);
+    }
+
+    for (size_t i = 0; i < iNbIndices; ++i) puiIndices[i] = static_cast<uint32_t>(m_vecItems[i]);
+}
@@ -0,0 +1,47 @@
+/**
+ * @file DrawListSorter.h
+ * @brief Defines the DrawListSorter class, which orders visible chunk boxes front to back with a
+ * radix sort on quantised depth.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "../core/Matrix.h"
+#include "Frustum.h"
+
+/**
+ * @class DrawListSorter
+ * @brief Sorts a list of box indices nearest first, so that an opaque depth-tested pass fills the
+ * depth buffer with near surfaces before the far ones are rasterised (less overdraw).
+ *
+ * The depth of a box is the clip-space z of its center, monotonic in view depth for perspective
+ * and orthographic projections alike. Depths are quantised to KEY_BITS over the list's own span
+ * and sorted with a stable LSD radix sort, 8 bits per pass: linear in the list size, with no
+ * comparisons and no allocation once the scratch arrays have grown.
+ */
+class DrawListSorter {
+public:
+    static constexpr int KEY_BITS = 16;  // Two 8-bit passes
+
+    /**
+     * @brief Reorders puiIndices[0, iNbIndices) (indices into objBoxes) by increasing depth of
+     * the boxes' centers under objViewProjection. Boxes whose depths quantise to the same key keep
+     * their relative order.
+     */
+    void SortFrontToBack(const BoxArraySoA& objBoxes,
+                         const Core::Mat4& objViewProjection,
+                         uint32_t* puiIndices,
+                         size_t iNbIndices);
+
+private:
+    static constexpr int RADIX_BITS = 8;
+    static constexpr int RADIX_BUCKETS = 1 << RADIX_BITS;
+
+    std::vector<float> m_vecDepths;
+    // Key in the high 32 bits, box index in the low ones; ping-pong between the two per pass
+    std::vector<uint64_t> m_vecItems;
+    std::vector<uint64_t> m_vecScratch;
+};
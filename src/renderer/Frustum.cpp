@@ -1,4 +1,5 @@
 #include "Frustum.h"
+#include "../core/CpuFeatures.h"
 
 // Enum for readable array access
 enum PlaneSide { PLANE_LEFT = 0, PLANE_RIGHT, PLANE_TOP, PLANE_BOTTOM, PLANE_NEAR, PLANE_FAR };
@@ -47,4 +48,26 @@ bool Frustum::IsBoxInVisibleFrustum(const AABB& box) const {
         }
     }
     return true;
-}
\ No newline at end of file
+}
+// ********************************************************************
+size_t Frustum::CullBoxes(const BoxArraySoA& objBoxes, uint32_t* puiVisible, bool bUseSIMD) const {
+    // cullBoxes_AVX2 lives in Frustum_AVX2.cpp, built with the AVX2 flags only
+    static const bool bHasAVX2 = Core::CpuFeatures::IsIsaSupported(Core::SimdIsa::AVX2);
+    if (!bUseSIMD || !bHasAVX2)
+        return cullBoxes(objBoxes, 0, puiVisible);
+
+    const size_t iNbVisible = cullBoxes_AVX2(m_arrPlanes.data(), objBoxes, puiVisible);
+    const size_t iTailBegin = objBoxes.m_iCount & ~static_cast<size_t>(7);
+    return iNbVisible + cullBoxes(objBoxes, iTailBegin, puiVisible + iNbVisible);
+}
+// ********************************************************************
+size_t Frustum::cullBoxes(const BoxArraySoA& objBoxes, size_t iBegin, uint32_t* puiVisible) const {
+    size_t iNbVisible = 0;
+    for (size_t i = iBegin; i < objBoxes.m_iCount; ++i) {
+        const Core::Vec3 objMin(objBoxes.m_pfMinX[i], objBoxes.m_pfMinY[i], objBoxes.m_pfMinZ[i]);
+        const Core::Vec3 objMax(objBoxes.m_pfMaxX[i], objBoxes.m_pfMaxY[i], objBoxes.m_pfMaxZ[i]);
+        if (IsBoxInVisibleFrustum(AABB(objMin, objMax)))
+            puiVisible[iNbVisible++] = static_cast<uint32_t>(i);
+    }
+    return iNbVisible;
+}
@@ -2,6 +2,8 @@
 
 #include <array>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include "../core/MathUtils.h"
 #include "../core/Matrix.h"
 #include "../physics/AABB.h"
@@ -28,6 +30,21 @@ struct Plane {
     }
 };
 
+/**
+ * @struct BoxArraySoA
+ * @brief m_iCount boxes as six parallel arrays (min and max per axis), the layout
+ * Frustum::CullBoxes streams through.
+ */
+struct BoxArraySoA {
+    const float* m_pfMinX = nullptr;
+    const float* m_pfMinY = nullptr;
+    const float* m_pfMinZ = nullptr;
+    const float* m_pfMaxX = nullptr;
+    const float* m_pfMaxY = nullptr;
+    const float* m_pfMaxZ = nullptr;
+    size_t m_iCount = 0;
+};
+
 /**
  * @class Frustum
  * @brief Represents the camera's viewing volume. Used for Culling.
@@ -48,6 +65,21 @@ public:
      */
     bool IsBoxInVisibleFrustum(const AABB& box) const;
 
+    /**
+     * @brief Same test for every box of objBoxes. Writes the indices of the visible boxes to
+     * puiVisible (room for objBoxes.m_iCount), in increasing order. Tests 8 boxes per iteration
+     * with AVX2 when the CPU supports it and bUseSIMD is set, with a scalar tail.
+     * @return The number of visible boxes.
+     */
+    size_t CullBoxes(const BoxArraySoA& objBoxes, uint32_t* puiVisible, bool bUseSIMD = true) const;
+
 private:
     std::array<Plane, 6> m_arrPlanes;
+
+    // Boxes [iBegin, m_iCount), one at a time
+    size_t cullBoxes(const BoxArraySoA& objBoxes, size_t iBegin, uint32_t* puiVisible) const;
+    // Frustum_AVX2.cpp (built with AVX2 only): the first m_iCount & ~7 boxes against 6 planes
+    static size_t cullBoxes_AVX2(const Plane* pPlanes,
+                                 const BoxArraySoA& objBoxes,
+                                 uint32_t* puiVisible);
 };
\ No newline at end of file
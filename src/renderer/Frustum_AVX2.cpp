@@ -0,0 +1,70 @@
+/**
+ * @file Frustum_AVX2.cpp
+ * @brief AVX2 build of the batch frustum test, 8 boxes per iteration (compiled with -mavx2 only
+ * here).
+ */
+
+// No std:: templates or inline helpers from the headers in this file: their instantiations are
+// shared between translation units at link time and must not come out of the one built for a
+// wider ISA. No FMA either, so every box gets exactly the scalar test's rounding.
+#include <immintrin.h>
+#include "Frustum.h"
+
+// ********************************************************************
+size_t Frustum::cullBoxes_AVX2(const Plane* pPlanes,
+                               const BoxArraySoA& objBoxes,
+                               uint32_t* puiVisible) {
+    const __m256 vecHalf = _mm256_set1_ps(0.5f);
+    const __m256 vecAbsMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+    __m256 arrA[6], arrB[6], arrC[6], arrD[6], arrAbsA[6], arrAbsB[6], arrAbsC[6];
+    for (int iPlane = 0; iPlane < 6; ++iPlane) {
+        arrA[iPlane] = _mm256_set1_ps(pPlanes[iPlane].a);
+        arrB[iPlane] = _mm256_set1_ps(pPlanes[iPlane].b);
+        arrC[iPlane] = _mm256_set1_ps(pPlanes[iPlane].c);
+        arrD[iPlane] = _mm256_set1_ps(pPlanes[iPlane].d);
+        arrAbsA[iPlane] = _mm256_and_ps(arrA[iPlane], vecAbsMask);
+        arrAbsB[iPlane] = _mm256_and_ps(arrB[iPlane], vecAbsMask);
+        arrAbsC[iPlane] = _mm256_and_ps(arrC[iPlane], vecAbsMask);
+    }
+
+    size_t iNbVisible = 0;
+    const size_t iEnd = objBoxes.m_iCount & ~static_cast<size_t>(7);
+    for (size_t i = 0; i < iEnd; i += 8) {
+        const __m256 vecMinX = _mm256_loadu_ps(objBoxes.m_pfMinX + i);
+        const __m256 vecMinY = _mm256_loadu_ps(objBoxes.m_pfMinY + i);
+        const __m256 vecMinZ = _mm256_loadu_ps(objBoxes.m_pfMinZ + i);
+        const __m256 vecMaxX = _mm256_loadu_ps(objBoxes.m_pfMaxX + i);
+        const __m256 vecMaxY = _mm256_loadu_ps(objBoxes.m_pfMaxY + i);
+        const __m256 vecMaxZ = _mm256_loadu_ps(objBoxes.m_pfMaxZ + i);
+        // Center + extent, as AABB::GetCenter/GetHalfExtents compute them
+        const __m256 vecCenterX = _mm256_mul_ps(_mm256_add_ps(vecMinX, vecMaxX), vecHalf);
+        const __m256 vecCenterY = _mm256_mul_ps(_mm256_add_ps(vecMinY, vecMaxY), vecHalf);
+        const __m256 vecCenterZ = _mm256_mul_ps(_mm256_add_ps(vecMinZ, vecMaxZ), vecHalf);
+        const __m256 vecExtentX = _mm256_mul_ps(_mm256_sub_ps(vecMaxX, vecMinX), vecHalf);
+        const __m256 vecExtentY = _mm256_mul_ps(_mm256_sub_ps(vecMaxY, vecMinY), vecHalf);
+        const __m256 vecExtentZ = _mm256_mul_ps(_mm256_sub_ps(vecMaxZ, vecMinZ), vecHalf);
+
+        __m256 vecVisible = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+        for (int iPlane = 0; iPlane < 6; ++iPlane) {
+            // Outside when the center is behind the plane by more than the projected radius
+            __m256 vecRadius = _mm256_mul_ps(vecExtentX, arrAbsA[iPlane]);
+            vecRadius = _mm256_add_ps(vecRadius, _mm256_mul_ps(vecExtentY, arrAbsB[iPlane]));
+            vecRadius = _mm256_add_ps(vecRadius, _mm256_mul_ps(vecExtentZ, arrAbsC[iPlane]));
+            __m256 vecDistance = _mm256_mul_ps(arrA[iPlane], vecCenterX);
+            vecDistance = _mm256_add_ps(vecDistance, _mm256_mul_ps(arrB[iPlane], vecCenterY));
+            vecDistance = _mm256_add_ps(vecDistance, _mm256_mul_ps(arrC[iPlane], vecCenterZ));
+            vecDistance = _mm256_add_ps(vecDistance, arrD[iPlane]);
+            const __m256 vecNegRadius = _mm256_xor_ps(vecRadius, _mm256_set1_ps(-0.0f));
+            vecVisible = _mm256_and_ps(vecVisible,
+                                       _mm256_cmp_ps(vecDistance, vecNegRadius, _CMP_NLT_UQ));
+        }
+
+        // Branch-free compaction: every lane is written, only visible ones advance the cursor
+        const int iMask = _mm256_movemask_ps(vecVisible);
+        for (int iLane = 0; iLane < 8; ++iLane) {
+            puiVisible[iNbVisible] = static_cast<uint32_t>(i) + static_cast<uint32_t>(iLane);
+            iNbVisible += static_cast<size_t>((iMask >> iLane) & 1);
+        }
+    }
+    return iNbVisible;
+}
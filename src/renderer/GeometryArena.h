@@ -0,0 +1,187 @@
+/**
+ * @file GeometryArena.h
+ * @brief Defines the GeometryArena class, one large storage buffer sub-allocated between the
+ * meshes of every chunk so the world draws with a single multi-draw-indirect call.
+ */
+
+#pragma once
+#include <glad/glad.h>
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+namespace Renderer {
+
+/**
+ * @class GeometryArena
+ * @brief RAII wrapper around one GL_SHADER_STORAGE_BUFFER of 32-bit words (one packed chunk face
+ * each) handed out in ranges by a first-fit free list. Freed ranges are merged with their free
+ * neighbours, so the list only holds the gaps between live meshes.
+ *
+ * Ranges are rounded up to BLOCK_WORDS, which leaves most remeshes room to be rewritten in place.
+ * When no gap is large enough the buffer doubles (the old contents are copied on the GPU and
+ * existing offsets stay valid), up to GL_MAX_SHADER_STORAGE_BLOCK_SIZE or a smaller cap given at
+ * construction.
+ */
+class GeometryArena {
+public:
+    static constexpr unsigned int BLOCK_WORDS = 64;  // 256 bytes
+
+    /**
+     * @struct Range
+     * @brief Words [m_uiOffset, m_uiOffset + m_uiSize) of the buffer.
+     */
+    struct Range {
+        unsigned int m_uiOffset = 0;
+        unsigned int m_uiSize = 0;
+    };
+
+    explicit GeometryArena(
+        unsigned int uiCapacityWords,
+        unsigned int uiMaxCapacityWords = std::numeric_limits<unsigned int>::max()) {
+        GLint iMaxBytes = 0;
+        glGetIntegerv(GL_MAX_SHADER_STORAGE_BLOCK_SIZE, &iMaxBytes);
+        m_uiMaxCapacity = std::max(
+            BLOCK_WORDS, std::min(static_cast<unsigned int>(iMaxBytes) / 4, uiMaxCapacityWords));
+        allocate(std::min(roundUp(std::max(uiCapacityWords, 1u)), m_uiMaxCapacity));
+    }
+
+    ~GeometryArena() { glDeleteBuffers(1, &m_uiID); }
+
+    GeometryArena(const GeometryArena&) = delete;
+    GeometryArena& operator=(const GeometryArena&) = delete;
+
+    /**
+     * @brief Takes a range of at least uiNbWords words, growing the buffer if needed. Its
+     * contents are undefined until written. Zero words give an empty range, which takes no block.
+     * @return false (objRange untouched, counted in GetFailedAllocationCount()) once the buffer
+     * cannot grow any further.
+     */
+    bool Allocate(unsigned int uiNbWords, Range& objRange) {
+        if (uiNbWords == 0) {
+            objRange = {};
+            return true;
+        }
+        const unsigned int uiSize = roundUp(uiNbWords);
+        auto itrGap = findGap(uiSize);
+        while (itrGap == m_vecFreeRanges.end()) {
+            if (!grow()) {
+                ++m_iNbFailedAllocations;
+                return false;
+            }
+            itrGap = findGap(uiSize);
+        }
+        objRange = {itrGap->m_uiOffset, uiSize};
+        itrGap->m_uiOffset += uiSize;
+        itrGap->m_uiSize -= uiSize;
+        if (itrGap->m_uiSize == 0)
+            m_vecFreeRanges.erase(itrGap);
+        m_uiUsedWords += uiSize;
+        return true;
+    }
+
+    void Free(const Range& objRange) {
+        if (objRange.m_uiSize == 0)
+            return;
+        m_uiUsedWords -= objRange.m_uiSize;
+        insertFreeRange(objRange);
+    }
+
+    /**
+     * @brief Writes uiNbWords words at the start of a range (uiNbWords <= its size).
+     */
+    void Write(const Range& objRange, const void* pData, unsigned int uiNbWords) const {
+        if (uiNbWords > 0)
+            glNamedBufferSubData(m_uiID,
+                                 static_cast<GLintptr>(objRange.m_uiOffset) * 4,
+                                 static_cast<GLsizeiptr>(uiNbWords) * 4,
+                                 pData);
+    }
+
+    /**
+     * @brief Binds the whole buffer to an indexed binding (layout(binding = N) buffer ...).
+     */
+    void BindBase(unsigned int uiBinding) const {
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, uiBinding, m_uiID);
+    }
+
+    unsigned int GetID() const { return m_uiID; }
+    unsigned int GetCapacity() const { return m_uiCapacity; }
+    unsigned int GetUsedWords() const { return m_uiUsedWords; }
+    /**
+     * @brief Gaps between live ranges (1 when the arena is not fragmented).
+     */
+    size_t GetFreeRangeCount() const { return m_vecFreeRanges.size(); }
+    /**
+     * @brief Allocate() calls refused since creation: the buffer was at its size limit.
+     */
+    size_t GetFailedAllocationCount() const { return m_iNbFailedAllocations; }
+
+private:
+    unsigned int m_uiID = 0;
+    unsigned int m_uiCapacity = 0;
+    unsigned int m_uiMaxCapacity = 0;
+    unsigned int m_uiUsedWords = 0;
+    size_t m_iNbFailedAllocations = 0;
+    std::vector<Range> m_vecFreeRanges;  // Sorted by offset, never adjacent
+
+    static unsigned int roundUp(unsigned int uiNbWords) {
+        return (uiNbWords + BLOCK_WORDS - 1) / BLOCK_WORDS * BLOCK_WORDS;
+    }
+
+    std::vector<Range>::iterator findGap(unsigned int uiSize) {
+        return std::find_if(m_vecFreeRanges.begin(),
+                            m_vecFreeRanges.end(),
+                            [uiSize](const Range& objGap) { return objGap.m_uiSize >= uiSize; });
+    }
+
+    void insertFreeRange(const Range& objRange) {
+        auto itrNext = std::find_if(
+            m_vecFreeRanges.begin(), m_vecFreeRanges.end(), [&objRange](const Range& objGap) {
+                return objGap.m_uiOffset > objRange.m_uiOffset;
+            });
+        const unsigned int uiEnd = objRange.m_uiOffset + objRange.m_uiSize;
+        const bool bMergeNext = itrNext != m_vecFreeRanges.end() && itrNext->m_uiOffset == uiEnd;
+        if (itrNext != m_vecFreeRanges.begin()) {
+            auto itrPrev = std::prev(itrNext);
+            if (itrPrev->m_uiOffset + itrPrev->m_uiSize == objRange.m_uiOffset) {
+                itrPrev->m_uiSize += objRange.m_uiSize;
+                if (bMergeNext) {
+                    itrPrev->m_uiSize += itrNext->m_uiSize;
+                    m_vecFreeRanges.erase(itrNext);
+                }
+                return;
+            }
+        }
+        if (bMergeNext) {
+            itrNext->m_uiOffset = objRange.m_uiOffset;
+            itrNext->m_uiSize += objRange.m_uiSize;
+            return;
+        }
+        m_vecFreeRanges.insert(itrNext, objRange);
+    }
+
+    void allocate(unsigned int uiCapacity) {
+        glCreateBuffers(1, &m_uiID);
+        glNamedBufferStorage(
+            m_uiID, static_cast<GLsizeiptr>(uiCapacity) * 4, nullptr, GL_DYNAMIC_STORAGE_BIT);
+        const unsigned int uiOldCapacity = m_uiCapacity;
+        m_uiCapacity = uiCapacity;
+        insertFreeRange({uiOldCapacity, uiCapacity - uiOldCapacity});
+    }
+
+    bool grow() {
+        if (m_uiCapacity >= m_uiMaxCapacity)
+            return false;
+        const unsigned int uiOldID = m_uiID;
+        const unsigned int uiOldCapacity = m_uiCapacity;
+        allocate(std::min(m_uiCapacity * 2, m_uiMaxCapacity));
+        glCopyNamedBufferSubData(uiOldID, m_uiID, 0, 0, static_cast<GLsizeiptr>(uiOldCapacity) * 4);
+        glDeleteBuffers(1, &uiOldID);
+        return true;
+    }
+};
+
+}  // namespace Renderer
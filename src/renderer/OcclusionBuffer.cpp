@@ -0,0 +1,192 @@
+#include "OcclusionBuffer.h"
+#include <emmintrin.h>
+#include <algorithm>
+#include <cmath>
+
+namespace {
+// Corners nearer than this (clip-space w) count as crossing the near plane
+constexpr float MIN_CLIP_W = 1e-3f;
+
+// Faces of a box and their corner indices (see projectBox), counter-clockwise seen from outside
+enum BoxFace { FACE_NEG_X = 0, FACE_POS_X, FACE_NEG_Y, FACE_POS_Y, FACE_NEG_Z, FACE_POS_Z };
+constexpr int BOX_FACES[6][4] = {
+    {0, 4, 6, 2}, {1, 3, 7, 5}, {0, 1, 5, 4}, {2, 6, 7, 3}, {0, 2, 3, 1}, {4, 5, 7, 6}};
+}  // namespace
+
+// ********************************************************************
+void OcclusionBuffer::Begin(const Core::Mat4& objViewProjection) {
+    m_objViewProjection = objViewProjection;
+    std::fill(m_vecDepth.begin(), m_vecDepth.end(), 0.0f);
+}
+
+// ********************************************************************
+bool OcclusionBuffer::projectPoint(const Core::Vec3& objPoint, ScreenPoint& objOut) const {
+    const float* e = m_objViewProjection.m_fElements;
+    const float fClipX = e[0] * objPoint.x + e[4] * objPoint.y + e[8] * objPoint.z + e[12];
+    const float fClipY = e[1] * objPoint.x + e[5] * objPoint.y + e[9] * objPoint.z + e[13];
+    const float fClipW = e[3] * objPoint.x + e[7] * objPoint.y + e[11] * objPoint.z + e[15];
+    if (!(fClipW > MIN_CLIP_W))
+        return false;
+    const float fInvW = 1.0f / fClipW;
+    objOut = {(fClipX * fInvW * 0.5f + 0.5f) * static_cast<float>(WIDTH),
+              (fClipY * fInvW * 0.5f + 0.5f) * static_cast<float>(HEIGHT),
+              fInvW};
+    return true;
+}
+
+// ********************************************************************
+Core::Vec3 OcclusionBuffer::getBoxCorner(const AABB& objBox, int iCorner) {
+    return Core::Vec3((iCorner & 1) ? objBox.m_objMaxPt.x : objBox.m_objMinPt.x,
+                      (iCorner & 2) ? objBox.m_objMaxPt.y : objBox.m_objMinPt.y,
+                      (iCorner & 4) ? objBox.m_objMaxPt.z : objBox.m_objMinPt.z);
+}
+
+// ********************************************************************
+void OcclusionBuffer::addBoxFace(const AABB& objBox, int iFace) {
+    ScreenPoint arrQuad[4];
+    for (int i = 0; i < 4; ++i) {
+        if (!projectPoint(getBoxCorner(objBox, BOX_FACES[iFace][i]), arrQuad[i]))
+            return;
+    }
+    // Faces turned away (clockwise on screen) are behind the front ones
+    const float fArea = (arrQuad[1].m_fX - arrQuad[0].m_fX) * (arrQuad[2].m_fY - arrQuad[0].m_fY) -
+                        (arrQuad[1].m_fY - arrQuad[0].m_fY) * (arrQuad[2].m_fX - arrQuad[0].m_fX);
+    if (!(fArea > 0.0f))
+        return;
+    // Flat at the farthest corner, never nearer than the real face
+    float fInvW = arrQuad[0].m_fInvW;
+    for (int i = 1; i < 4; ++i) fInvW = std::min(fInvW, arrQuad[i].m_fInvW);
+    rasterizeQuad(arrQuad, fInvW);
+}
+
+// ********************************************************************
+void OcclusionBuffer::AddOccluder(const AABB& objBox) {
+    for (int iFace = 0; iFace < 6; ++iFace) addBoxFace(objBox, iFace);
+}
+
+// ********************************************************************
+void OcclusionBuffer::AddOccluderColumn(const AABB& objColumn,
+                                        const float arrNeighbourHeights[4]) {
+    addBoxFace(objColumn, FACE_POS_Y);
+    const int arrSides[4] = {FACE_NEG_X, FACE_POS_X, FACE_NEG_Z, FACE_POS_Z};
+    for (int i = 0; i < 4; ++i) {
+        if (arrNeighbourHeights[i] >= objColumn.m_objMaxPt.y)
+            continue;
+        AABB objStrip = objColumn;
+        objStrip.m_objMinPt.y = std::max(objStrip.m_objMinPt.y, arrNeighbourHeights[i]);
+        addBoxFace(objStrip, arrSides[i]);
+    }
+}
+
+// ********************************************************************
+void OcclusionBuffer::rasterizeQuad(const ScreenPoint arrQuad[4], float fInvW) {
+    // Pixels whose center (i + 0.5) lies within the quad's bounds
+    float fMinX = arrQuad[0].m_fX, fMaxX = fMinX;
+    float fMinY = arrQuad[0].m_fY, fMaxY = fMinY;
+    for (int i = 1; i < 4; ++i) {
+        fMinX = std::min(fMinX, arrQuad[i].m_fX);
+        fMaxX = std::max(fMaxX, arrQuad[i].m_fX);
+        fMinY = std::min(fMinY, arrQuad[i].m_fY);
+        fMaxY = std::max(fMaxY, arrQuad[i].m_fY);
+    }
+    if (fMaxX < 0.0f || fMinX > WIDTH || fMaxY < 0.0f || fMinY > HEIGHT)
+        return;
+    const int iX0 = static_cast<int>(std::ceil(std::max(fMinX - 0.5f, 0.0f)));
+    const int iX1 = static_cast<int>(std::floor(std::min(fMaxX - 0.5f, WIDTH - 1.0f)));
+    const int iY0 = static_cast<int>(std::ceil(std::max(fMinY - 0.5f, 0.0f)));
+    const int iY1 = static_cast<int>(std::floor(std::min(fMaxY - 0.5f, HEIGHT - 1.0f)));
+    if (iX0 > iX1 || iY0 > iY1)
+        return;
+
+    // Edge P -> Q: (Q.x - P.x) * (y - P.y) - (Q.y - P.y) * (x - P.x), >= 0 inside (convex and
+    // counter-clockwise)
+    float arrStepX[4], arrStepY[4], arrFromX[4], arrFromY[4];
+    for (int i = 0; i < 4; ++i) {
+        const ScreenPoint& objFrom = arrQuad[i];
+        const ScreenPoint& objTo = arrQuad[(i + 1) % 4];
+        arrStepX[i] = objFrom.m_fY - objTo.m_fY;
+        arrStepY[i] = objTo.m_fX - objFrom.m_fX;
+        arrFromX[i] = objFrom.m_fX;
+        arrFromY[i] = objFrom.m_fY;
+    }
+
+    // Whole 4-pixel groups: lanes outside the bounds are outside the quad too, and WIDTH is a
+    // multiple of 4 so no group crosses the end of a row
+    const int iGroupX0 = iX0 & ~3;
+    const __m128 vecLaneX = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+    const __m128 vecZero = _mm_setzero_ps();
+    const __m128 vecDepth = _mm_set1_ps(fInvW);
+    __m128 arrEdgeStep[4];
+    for (int i = 0; i < 4; ++i) arrEdgeStep[i] = _mm_set1_ps(arrStepX[i] * 4.0f);
+    for (int iY = iY0; iY <= iY1; ++iY) {
+        const float fY = static_cast<float>(iY) + 0.5f;
+        __m128 arrEdge[4];
+        for (int i = 0; i < 4; ++i) {
+            const float fRowStart = arrStepY[i] * (fY - arrFromY[i]) +
+                                    arrStepX[i] * (static_cast<float>(iGroupX0) - arrFromX[i]);
+            arrEdge[i] = _mm_add_ps(_mm_set1_ps(fRowStart),
+                                    _mm_mul_ps(_mm_set1_ps(arrStepX[i]), vecLaneX));
+        }
+        float* pfRow = m_vecDepth.data() + static_cast<size_t>(iY) * WIDTH;
+        for (int iX = iGroupX0; iX <= iX1; iX += 4) {
+            const __m128 vecInside = _mm_and_ps(
+                _mm_and_ps(_mm_cmpge_ps(arrEdge[0], vecZero), _mm_cmpge_ps(arrEdge[1], vecZero)),
+                _mm_and_ps(_mm_cmpge_ps(arrEdge[2], vecZero), _mm_cmpge_ps(arrEdge[3], vecZero)));
+            if (_mm_movemask_ps(vecInside) != 0) {
+                const __m128 vecOld = _mm_loadu_ps(pfRow + iX);
+                const __m128 vecNew = _mm_max_ps(vecOld, vecDepth);
+                _mm_storeu_ps(pfRow + iX,
+                              _mm_or_ps(_mm_and_ps(vecInside, vecNew),
+                                        _mm_andnot_ps(vecInside, vecOld)));
+            }
+            for (int i = 0; i < 4; ++i) arrEdge[i] = _mm_add_ps(arrEdge[i], arrEdgeStep[i]);
+        }
+    }
+}
+
+// ********************************************************************
+bool OcclusionBuffer::IsOccluded(const AABB& objBox) const {
+    ScreenPoint arrCorners[8];
+    for (int i = 0; i < 8; ++i) {
+        if (!projectPoint(getBoxCorner(objBox, i), arrCorners[i]))
+            return false;
+    }
+    float fMinX = arrCorners[0].m_fX, fMaxX = fMinX;
+    float fMinY = arrCorners[0].m_fY, fMaxY = fMinY;
+    float fNearest = arrCorners[0].m_fInvW;
+    for (int i = 1; i < 8; ++i) {
+        fMinX = std::min(fMinX, arrCorners[i].m_fX);
+        fMaxX = std::max(fMaxX, arrCorners[i].m_fX);
+        fMinY = std::min(fMinY, arrCorners[i].m_fY);
+        fMaxY = std::max(fMaxY, arrCorners[i].m_fY);
+        fNearest = std::max(fNearest, arrCorners[i].m_fInvW);
+    }
+    // Off screen: the frustum test decides
+    if (fMaxX < 0.0f || fMinX >= WIDTH || fMaxY < 0.0f || fMinY >= HEIGHT)
+        return false;
+    // Every pixel the projected bounds touch, plus a ring of one pixel: occluders only cover the
+    // pixels whose center they contain, so a pixel counts as hidden when its neighbours are too
+    const int iX0 = static_cast<int>(std::floor(std::max(fMinX - 1.0f, 0.0f)));
+    const int iX1 = static_cast<int>(std::floor(std::min(fMaxX + 1.0f, WIDTH - 1.0f)));
+    const int iY0 = static_cast<int>(std::floor(std::max(fMinY - 1.0f, 0.0f)));
+    const int iY1 = static_cast<int>(std::floor(std::min(fMaxY + 1.0f, HEIGHT - 1.0f)));
+
+    const __m128 vecNearest = _mm_set1_ps(fNearest);
+    const __m128i vecLaneX = _mm_setr_epi32(0, 1, 2, 3);
+    const __m128i vecBeforeFirst = _mm_set1_epi32(iX0 - 1);
+    const __m128i vecAfterLast = _mm_set1_epi32(iX1 + 1);
+    for (int iY = iY0; iY <= iY1; ++iY) {
+        const float* pfRow = m_vecDepth.data() + static_cast<size_t>(iY) * WIDTH;
+        for (int iX = iX0 & ~3; iX <= iX1; iX += 4) {
+            const __m128i vecX = _mm_add_epi32(_mm_set1_epi32(iX), vecLaneX);
+            const __m128i vecInRange = _mm_and_si128(_mm_cmpgt_epi32(vecX, vecBeforeFirst),
+                                                     _mm_cmplt_epi32(vecX, vecAfterLast));
+            // A pixel with nothing nearer than the box's nearest corner shows the box
+            const __m128 vecShown = _mm_and_ps(_mm_castsi128_ps(vecInRange),
+                                               _mm_cmple_ps(_mm_loadu_ps(pfRow + iX), vecNearest));
+            if (_mm_movemask_ps(vecShown) != 0)
+                return false;
+        }
+    }
+    return true;
+}
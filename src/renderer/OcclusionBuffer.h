@@ -0,0 +1,84 @@
+/**
+ * @file OcclusionBuffer.h
+ * @brief Defines the OcclusionBuffer class, a coarse depth buffer rasterised on the CPU to skip
+ * chunks hidden behind terrain.
+ */
+
+#pragma once
+
+#include <vector>
+#include "../core/Matrix.h"
+#include "../physics/AABB.h"
+
+/**
+ * @class OcclusionBuffer
+ * @brief WIDTH x HEIGHT pixels of 1 / w (clip-space w, so larger is nearer, 0 is empty) over the
+ * camera's view. Solid boxes and terrain columns are rasterised as occluders (the faces turned to
+ * the camera, as convex quads), then AABBs are tested against them:
+ * a box is hidden when every pixel its projection touches holds an occluder nearer than the
+ * box's nearest corner. Rows are filled and tested 4 pixels at a time with SSE2.
+ *
+ * Both sides stay conservative: an occluder face is written at the depth of its farthest corner,
+ * faces crossing the near plane are dropped and boxes crossing it are never reported hidden. No GPU
+ * involved.
+ */
+class OcclusionBuffer {
+public:
+    static constexpr int WIDTH = 256;  // Multiple of 4 (one SSE2 register per 4 pixels)
+    static constexpr int HEIGHT = 128;
+
+    OcclusionBuffer() : m_vecDepth(static_cast<size_t>(WIDTH) * HEIGHT, 0.0f) {}
+
+    /**
+     * @brief Empties the buffer and sets the camera of the following calls.
+     */
+    void Begin(const Core::Mat4& objViewProjection);
+
+    /**
+     * @brief Rasterises a box that is solid throughout.
+     */
+    void AddOccluder(const AABB& objBox);
+
+    /**
+     * @brief Rasterises a solid column standing among others on a grid (terrain): its top, and
+     * each side where it rises above the neighbouring column, given as the neighbours' heights
+     * (-X, +X, -Z, +Z; 0 when unknown). The faces between columns are inside and never drawn.
+     */
+    void AddOccluderColumn(const AABB& objColumn, const float arrNeighbourHeights[4]);
+
+    /**
+     * @return true if the occluders added since Begin() hide the whole box.
+     */
+    bool IsOccluded(const AABB& objBox) const;
+
+    /**
+     * @brief 1 / w at pixel (iX, iY), row 0 at the bottom of the view (0: no occluder).
+     */
+    float GetDepth(int iX, int iY) const {
+        return m_vecDepth[static_cast<size_t>(iY) * WIDTH + static_cast<size_t>(iX)];
+    }
+
+private:
+    /**
+     * @struct ScreenPoint
+     * @brief A projected corner: buffer pixel coordinates and 1 / w.
+     */
+    struct ScreenPoint {
+        float m_fX;
+        float m_fY;
+        float m_fInvW;
+    };
+
+    Core::Mat4 m_objViewProjection;
+    std::vector<float> m_vecDepth;  // Row-major, WIDTH floats per row
+
+    // @return false if the point is not in front of the camera
+    bool projectPoint(const Core::Vec3& objPoint, ScreenPoint& objOut) const;
+    // Corner i takes the max of X if bit 0 is set, of Y for bit 1, of Z for bit 2
+    static Core::Vec3 getBoxCorner(const AABB& objBox, int iCorner);
+    // Skipped when turned away or when a corner is not in front of the camera
+    void addBoxFace(const AABB& objBox, int iFace);
+    // Pixels whose center is inside the quad (convex, counter-clockwise on screen) keep
+    // max(their depth, fInvW)
+    void rasterizeQuad(const ScreenPoint arrQuad[4], float fInvW);
+};
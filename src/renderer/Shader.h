@@ -83,6 +83,10 @@ public:
         glUniform1i(glGetUniformLocation(ID, name.c_str()), iValue);
     }
 
+    void SetIVec2(const std::string &name, int iX, int iY) const {
+        glUniform2i(glGetUniformLocation(ID, name.c_str()), iX, iY);
+    }
+
 private:
     void checkCompileErrors(unsigned int uiShader, std::string strType) {
         int iSuccess;
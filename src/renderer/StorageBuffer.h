@@ -0,0 +1,60 @@
+#pragma once
+#include <glad/glad.h>
+
+namespace Renderer {
+
+/**
+ * @class StorageBuffer
+ * @brief Wrapper for an OpenGL SSBO (Shader Storage Buffer Object).
+ * Holds raw records the shaders or the draw commands index themselves (e.g. per-draw data).
+ */
+class StorageBuffer {
+public:
+    unsigned int m_RendererID;
+    unsigned int m_uiSize;
+    unsigned int m_uiCapacity;
+
+    /**
+     * @brief Creates the buffer with uiCapacity >= uiSize bytes of storage and fills the first
+     * uiSize bytes, so later, larger contents can be written in place (see Update()).
+     */
+    StorageBuffer(const void* data, unsigned int uiSize, unsigned int uiCapacity)
+        : m_uiSize(uiSize), m_uiCapacity(uiCapacity < uiSize ? uiSize : uiCapacity) {
+        glCreateBuffers(1, &m_RendererID);
+        glNamedBufferData(m_RendererID, m_uiCapacity, nullptr, GL_STATIC_DRAW);
+        glNamedBufferSubData(m_RendererID, 0, uiSize, data);
+    }
+
+    ~StorageBuffer() { glDeleteBuffers(1, &m_RendererID); }
+
+    StorageBuffer(const StorageBuffer&) = delete;
+    StorageBuffer& operator=(const StorageBuffer&) = delete;
+
+    /**
+     * @brief Binds the whole buffer to an indexed binding (layout(binding = N) buffer ...).
+     */
+    void BindBase(unsigned int uiBinding) const {
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, uiBinding, m_RendererID);
+    }
+
+    /**
+     * @brief Binds to a non-indexed target, e.g. GL_DRAW_INDIRECT_BUFFER for draw commands.
+     */
+    void Bind(GLenum eTarget) const { glBindBuffer(eTarget, m_RendererID); }
+
+    /**
+     * @brief Replaces the contents in place (glNamedBufferSubData) when they fit the storage.
+     * @return false (nothing written) when uiSize exceeds the capacity.
+     */
+    bool Update(const void* data, unsigned int uiSize) {
+        if (uiSize > m_uiCapacity)
+            return false;
+        glNamedBufferSubData(m_RendererID, 0, uiSize, data);
+        m_uiSize = uiSize;
+        return true;
+    }
+
+    unsigned int GetSize() const { return m_uiSize; }
+    unsigned int GetCapacity() const { return m_uiCapacity; }
+};
+}  // namespace Renderer
@@ -0,0 +1,153 @@
+/**
+ * @file ThermalAtlas.h
+ * @brief Defines the ThermalAtlas class, a single 3D texture holding the thermal fields of every
+ * heated chunk in fixed-size slots.
+ */
+
+#pragma once
+#include <glad/glad.h>
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace Renderer {
+
+/**
+ * @class ThermalAtlas
+ * @brief RAII wrapper around one GL_R32F 3D texture split into a grid of equally sized slots
+ * (one padded chunk field each). Slots are numbered X first, then Y, then Z, so the vertex shader
+ * finds a slot's origin from its index and the grid width/height alone.
+ *
+ * The whole atlas stays bound to one texture unit; a draw only selects its slot. Every slot keeps
+ * its own halo and is sampled strictly inside it, so linear filtering never blends two slots.
+ * When the free list runs dry the grid doubles along Z (existing slot indices stay valid), up to
+ * GL_MAX_3D_TEXTURE_SIZE.
+ */
+class ThermalAtlas {
+public:
+    ThermalAtlas(int iSlotSizeX, int iSlotSizeY, int iSlotSizeZ, int iGridX, int iGridY, int iGridZ)
+        : m_iSlotSizeX(iSlotSizeX),
+          m_iSlotSizeY(iSlotSizeY),
+          m_iSlotSizeZ(iSlotSizeZ),
+          m_iGridX(iGridX),
+          m_iGridY(iGridY) {
+        GLint iMaxSize = 0;
+        glGetIntegerv(GL_MAX_3D_TEXTURE_SIZE, &iMaxSize);
+        m_iMaxGridZ = std::max(1, static_cast<int>(iMaxSize) / m_iSlotSizeZ);
+        allocate(std::min(iGridZ, m_iMaxGridZ));
+    }
+
+    ~ThermalAtlas() { glDeleteTextures(1, &m_uiID); }
+
+    ThermalAtlas(const ThermalAtlas&) = delete;
+    ThermalAtlas& operator=(const ThermalAtlas&) = delete;
+
+    /**
+     * @brief Takes a free slot, growing the atlas if needed. The slot's texels are undefined
+     * until its first upload.
+     * @return The slot index, or -1 once the atlas cannot grow any further.
+     */
+    int AllocateSlot() {
+        if (m_vecFreeSlots.empty() && !grow())
+            return -1;
+        const int iSlot = m_vecFreeSlots.back();
+        m_vecFreeSlots.pop_back();
+        return iSlot;
+    }
+
+    void FreeSlot(int iSlot) {
+        if (iSlot >= 0)
+            m_vecFreeSlots.push_back(iSlot);
+    }
+
+    /**
+     * @brief Texel origin of a slot inside the atlas.
+     */
+    void GetSlotOrigin(int iSlot, int& iOutX, int& iOutY, int& iOutZ) const {
+        iOutX = (iSlot % m_iGridX) * m_iSlotSizeX;
+        iOutY = ((iSlot / m_iGridX) % m_iGridY) * m_iSlotSizeY;
+        iOutZ = (iSlot / (m_iGridX * m_iGridY)) * m_iSlotSizeZ;
+    }
+
+    void Update(int iSlot, const float* pfData) const { updateSlot(iSlot, GL_FLOAT, pfData); }
+
+    /**
+     * @brief Uploads raw binary16 values (half the bytes; the driver widens them to R32F).
+     */
+    void Update(int iSlot, const uint16_t* puiHalfData) const {
+        updateSlot(iSlot, GL_HALF_FLOAT, puiHalfData);
+    }
+
+    void Bind(unsigned int iUnit) const { glBindTextureUnit(iUnit, m_uiID); }
+
+    unsigned int GetID() const { return m_uiID; }
+    int GetSlotSizeX() const { return m_iSlotSizeX; }
+    int GetSlotSizeY() const { return m_iSlotSizeY; }
+    int GetSlotSizeZ() const { return m_iSlotSizeZ; }
+    int GetGridX() const { return m_iGridX; }
+    int GetGridY() const { return m_iGridY; }
+    int GetCapacity() const { return m_iGridX * m_iGridY * m_iGridZ; }
+    int GetUsedSlotCount() const { return GetCapacity() - static_cast<int>(m_vecFreeSlots.size()); }
+
+private:
+    unsigned int m_uiID = 0;
+    int m_iSlotSizeX, m_iSlotSizeY, m_iSlotSizeZ;
+    int m_iGridX, m_iGridY, m_iGridZ = 0;
+    int m_iMaxGridZ = 1;
+    std::vector<int> m_vecFreeSlots;
+
+    void allocate(int iGridZ) {
+        glCreateTextures(GL_TEXTURE_3D, 1, &m_uiID);
+        glTextureParameteri(m_uiID, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTextureParameteri(m_uiID, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glTextureParameteri(m_uiID, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+        glTextureParameteri(m_uiID, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTextureParameteri(m_uiID, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTextureStorage3D(m_uiID,
+                           1,
+                           GL_R32F,
+                           m_iGridX * m_iSlotSizeX,
+                           m_iGridY * m_iSlotSizeY,
+                           iGridZ * m_iSlotSizeZ);
+
+        // Hand out low indices first: the free list is popped from the back
+        const int iOldCapacity = GetCapacity();
+        m_iGridZ = iGridZ;
+        for (int iSlot = GetCapacity() - 1; iSlot >= iOldCapacity; --iSlot)
+            m_vecFreeSlots.push_back(iSlot);
+    }
+
+    bool grow() {
+        if (m_iGridZ >= m_iMaxGridZ)
+            return false;
+        const unsigned int uiOldID = m_uiID;
+        const int iOldDepth = m_iGridZ * m_iSlotSizeZ;
+        allocate(std::min(m_iGridZ * 2, m_iMaxGridZ));
+        glCopyImageSubData(uiOldID,
+                           GL_TEXTURE_3D,
+                           0,
+                           0,
+                           0,
+                           0,
+                           m_uiID,
+                           GL_TEXTURE_3D,
+                           0,
+                           0,
+                           0,
+                           0,
+                           m_iGridX * m_iSlotSizeX,
+                           m_iGridY * m_iSlotSizeY,
+                           iOldDepth);
+        glDeleteTextures(1, &uiOldID);
+        return true;
+    }
+
+    void updateSlot(int iSlot, GLenum eType, const void* pData) const {
+        int iX = 0, iY = 0, iZ = 0;
+        GetSlotOrigin(iSlot, iX, iY, iZ);
+        glTextureSubImage3D(
+            m_uiID, 0, iX, iY, iZ, m_iSlotSizeX, m_iSlotSizeY, m_iSlotSizeZ, GL_RED, eType, pData);
+    }
+};
+
+}  // namespace Renderer
@@ -0,0 +1,162 @@
+/**
+ * @file ThermalUploadRing.h
+ * @brief Defines the ThermalUploadRing class, a persistently mapped pixel-unpack buffer that
+ * streams thermal texture uploads without stalling the CPU on the driver.
+ */
+
+#pragma once
+#include <glad/glad.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "ThermalAtlas.h"
+
+namespace Renderer {
+
+/**
+ * @class ThermalUploadRing
+ * @brief NB_SEGMENTS frames worth of staging memory in one GL_PIXEL_UNPACK_BUFFER, mapped once
+ * for the lifetime of the ring (persistent + coherent). Each frame writes into its own segment
+ * and fences it; a segment is only reused once the GPU has signalled that fence.
+ *
+ * The fence is polled, never waited on: while the GPU still reads the segment (or once the frame
+ * filled it) Upload() returns false and the caller keeps its data pending for a later frame.
+ * Frames are numbered, so callers can tell when the copies queued in a given frame have landed
+ * (IsRetired()).
+ */
+class ThermalUploadRing {
+public:
+    static constexpr int NB_SEGMENTS = 3;
+    static constexpr size_t UPLOAD_ALIGNMENT = 64;
+
+    explicit ThermalUploadRing(size_t iSegmentBytes) : m_iSegmentBytes(iSegmentBytes) {
+        const GLbitfield uiFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        const auto iTotalBytes = static_cast<GLsizeiptr>(m_iSegmentBytes * NB_SEGMENTS);
+        glCreateBuffers(1, &m_uiBufferID);
+        glNamedBufferStorage(m_uiBufferID, iTotalBytes, nullptr, uiFlags);
+        m_pMapped = static_cast<unsigned char*>(
+            glMapNamedBufferRange(m_uiBufferID, 0, iTotalBytes, uiFlags));
+    }
+
+    ~ThermalUploadRing() {
+        for (GLsync& pFence : m_arrFences) {
+            if (pFence)
+                glDeleteSync(pFence);
+        }
+        glUnmapNamedBuffer(m_uiBufferID);
+        glDeleteBuffers(1, &m_uiBufferID);
+    }
+
+    ThermalUploadRing(const ThermalUploadRing&) = delete;
+    ThermalUploadRing& operator=(const ThermalUploadRing&) = delete;
+
+    /**
+     * @brief Retires the segments the GPU is done with and moves to the next one. If the GPU has
+     * not consumed it yet, this frame uploads nothing.
+     */
+    void BeginFrame() {
+        retireSegments();
+        m_iSegment = (m_iSegment + 1) % NB_SEGMENTS;
+        ++m_uiFrameSerial;
+        m_iOffset = 0;
+        m_bSegmentReady = !m_arrFences[m_iSegment];
+        if (!m_bSegmentReady)
+            ++m_iNbStalledFrames;
+    }
+
+    /**
+     * @brief Copies iBytes of texels into the segment and queues the update of one atlas slot
+     * from it.
+     * @param eType GL_FLOAT or GL_HALF_FLOAT, single channel.
+     * @return false (nothing queued) when the segment is busy or full.
+     */
+    bool Upload(
+        const ThermalAtlas& objAtlas, int iSlot, const void* pData, size_t iBytes, GLenum eType) {
+        if (!m_bSegmentReady || !m_pMapped || m_iOffset + iBytes > m_iSegmentBytes)
+            return false;
+
+        const size_t iRingOffset = static_cast<size_t>(m_iSegment) * m_iSegmentBytes + m_iOffset;
+        std::memcpy(m_pMapped + iRingOffset, pData, iBytes);
+        int iX = 0, iY = 0, iZ = 0;
+        objAtlas.GetSlotOrigin(iSlot, iX, iY, iZ);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_uiBufferID);
+        glTextureSubImage3D(objAtlas.GetID(),
+                            0,
+                            iX,
+                            iY,
+                            iZ,
+                            objAtlas.GetSlotSizeX(),
+                            objAtlas.GetSlotSizeY(),
+                            objAtlas.GetSlotSizeZ(),
+                            GL_RED,
+                            eType,
+                            reinterpret_cast<const void*>(iRingOffset));
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+        m_iOffset += (iBytes + UPLOAD_ALIGNMENT - 1) & ~(UPLOAD_ALIGNMENT - 1);
+        ++m_iNbFrameUploads;
+        return true;
+    }
+
+    /**
+     * @brief Fences the segment if this frame wrote into it.
+     */
+    void EndFrame() {
+        m_iLastFrameUploads = m_iNbFrameUploads;
+        m_iNbFrameUploads = 0;
+        if (m_bSegmentReady && m_iOffset > 0) {
+            m_arrFences[m_iSegment] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            m_arrFenceSerials[m_iSegment] = m_uiFrameSerial;
+        }
+    }
+
+    /**
+     * @brief Number of the current frame (1 for the first BeginFrame()).
+     */
+    uint64_t GetFrameSerial() const { return m_uiFrameSerial; }
+    /**
+     * @brief True once every copy queued up to frame uiSerial has landed in its texture, as of
+     * the fences polled by the last BeginFrame().
+     */
+    bool IsRetired(uint64_t uiSerial) const { return uiSerial <= m_uiRetiredSerial; }
+
+    int GetLastFrameUploads() const { return m_iLastFrameUploads; }
+    int GetStalledFrameCount() const { return m_iNbStalledFrames; }
+
+private:
+    unsigned int m_uiBufferID = 0;
+    unsigned char* m_pMapped = nullptr;
+    size_t m_iSegmentBytes = 0;
+    int m_iSegment = 0;
+    size_t m_iOffset = 0;
+    bool m_bSegmentReady = false;
+    GLsync m_arrFences[NB_SEGMENTS] = {nullptr};
+    uint64_t m_arrFenceSerials[NB_SEGMENTS] = {0};
+    uint64_t m_uiFrameSerial = 0;
+    uint64_t m_uiRetiredSerial = 0;
+    int m_iNbFrameUploads = 0;
+    int m_iLastFrameUploads = 0;
+    int m_iNbStalledFrames = 0;
+
+    // Polls the fences oldest first. They signal in order, so the first busy one bounds the
+    // retired frames; frames that fenced nothing queued no copy
+    void retireSegments() {
+        m_uiRetiredSerial = m_uiFrameSerial;
+        for (int iAge = 1; iAge <= NB_SEGMENTS; ++iAge) {
+            const int iSegment = (m_iSegment + iAge) % NB_SEGMENTS;
+            GLsync& pFence = m_arrFences[iSegment];
+            if (!pFence)
+                continue;
+            const GLenum eStatus = glClientWaitSync(pFence, 0, 0);  // Poll only
+            if (eStatus == GL_TIMEOUT_EXPIRED || eStatus == GL_WAIT_FAILED) {
+                m_uiRetiredSerial = m_arrFenceSerials[iSegment] - 1;
+                return;
+            }
+            glDeleteSync(pFence);
+            pFence = nullptr;
+        }
+    }
+};
+
+}  // namespace Renderer
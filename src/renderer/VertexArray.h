@@ -56,6 +56,28 @@ public:
         // 4. Link the Attribute Index to that Binding Point
         glVertexArrayAttribBinding(m_RendererID, iLayoutIndex, iLayoutIndex);
     }
+
+    /**
+     * @brief Configures an integer vertex attribute (read by the shader as int/uint/ivecN/uvecN,
+     * never converted to float).
+     * @param eType GL_UNSIGNED_INT, GL_INT, GL_UNSIGNED_SHORT, ...
+     * @param iStrideBytes Total number of BYTES between elements.
+     * @param uiDivisor 0 advances per vertex, N per N instances (offset by the draw's
+     * baseInstance, which is how multi-draw-indirect commands pass their draw index).
+     */
+    void LinkIntegerAttribute(const VertexBuffer &vbo,
+                              unsigned int iLayoutIndex,
+                              int iNumComponents,
+                              GLenum eType,
+                              int iStrideBytes,
+                              unsigned int uiDivisor = 0) const {
+        glEnableVertexArrayAttrib(m_RendererID, iLayoutIndex);
+        glVertexArrayAttribIFormat(m_RendererID, iLayoutIndex, iNumComponents, eType, 0);
+        glVertexArrayVertexBuffer(m_RendererID, iLayoutIndex, vbo.m_RendererID, 0, iStrideBytes);
+        glVertexArrayAttribBinding(m_RendererID, iLayoutIndex, iLayoutIndex);
+        glVertexArrayBindingDivisor(m_RendererID, iLayoutIndex, uiDivisor);
+    }
+
     /**
      * @brief Attaches an IndexBuffer to this VAO using DSA.
      * @param ibo The IndexBuffer to attach.
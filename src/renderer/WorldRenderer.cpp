@@ -1,10 +1,232 @@
 #include "WorldRenderer.h"
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+#include <vector>
 #include "../world/Chunk.h"
 #include "Frustum.h"
 #include "PrimitiveRenderer.h"
 
 namespace Renderer {
 
+VertexArray* WorldRenderer::m_pQuadVAO = nullptr;
+IndexBuffer* WorldRenderer::m_pQuadIBO = nullptr;
+size_t WorldRenderer::m_iDrawCapacity = 0;
+VertexBuffer* WorldRenderer::m_pDrawIdVBO = nullptr;
+StorageBuffer* WorldRenderer::m_pDrawCommandBuffer = nullptr;
+StorageBuffer* WorldRenderer::m_pDrawDataBuffer = nullptr;
+std::vector<WorldRenderer::DrawElementsIndirectCommand> WorldRenderer::m_vecDrawCommands;
+std::vector<WorldRenderer::ChunkDrawData> WorldRenderer::m_vecDrawData;
+std::vector<uint32_t> WorldRenderer::m_vecVisibleIndices;
+double WorldRenderer::m_dLastCullingMs = 0.0;
+OcclusionBuffer* WorldRenderer::m_pOcclusionBuffer = nullptr;
+std::vector<std::pair<float, uint32_t>> WorldRenderer::m_vecOccluderOrder;
+int WorldRenderer::m_iLastOccludedChunks = 0;
+double WorldRenderer::m_dLastOcclusionMs = 0.0;
+DrawListSorter WorldRenderer::m_objDrawListSorter;
+double WorldRenderer::m_dLastDrawSortMs = 0.0;
+unsigned int WorldRenderer::m_arrSampleQueries[2] = {0, 0};
+bool WorldRenderer::m_arrSampleQueryPending[2] = {false, false};
+int WorldRenderer::m_iSampleQuery = 0;
+uint64_t WorldRenderer::m_uiLastSamplesPassed = 0;
+ThermalUploadRing* WorldRenderer::m_pThermalUploadRing = nullptr;
+ThermalAtlas* WorldRenderer::m_pThermalAtlas = nullptr;
+
+// ********************************************************************
+void WorldRenderer::Init() {
+    if (!m_pQuadIBO) {
+        const auto uiNbQuads = static_cast<unsigned int>(MAX_CHUNK_FACES);
+        std::vector<unsigned int> vecIndices(static_cast<size_t>(uiNbQuads) * 6);
+        for (unsigned int uiQuad = 0; uiQuad < uiNbQuads; ++uiQuad) {
+            unsigned int* puiIndex = &vecIndices[uiQuad * 6];
+            const unsigned int uiStart = uiQuad * 4;
+            puiIndex[0] = uiStart + 0;
+            puiIndex[1] = uiStart + 1;
+            puiIndex[2] = uiStart + 2;
+            puiIndex[3] = uiStart + 2;
+            puiIndex[4] = uiStart + 3;
+            puiIndex[5] = uiStart + 0;
+        }
+        m_pQuadIBO =
+            new IndexBuffer(vecIndices.data(), static_cast<unsigned int>(vecIndices.size()));
+        m_pQuadVAO = new VertexArray();
+        m_pQuadVAO->AttachIndexBuffer(*m_pQuadIBO);
+    }
+    if (!m_pThermalUploadRing)
+        m_pThermalUploadRing = new ThermalUploadRing(THERMAL_UPLOAD_SEGMENT_BYTES);
+    if (!m_pThermalAtlas)
+        m_pThermalAtlas = new ThermalAtlas(PADDED_CHUNK_SIZE,
+                                           PADDED_CHUNK_HEIGHT,
+                                           PADDED_CHUNK_SIZE,
+                                           THERMAL_ATLAS_GRID_X,
+                                           THERMAL_ATLAS_GRID_Y,
+                                           THERMAL_ATLAS_GRID_Z);
+    if (!m_pOcclusionBuffer)
+        m_pOcclusionBuffer = new OcclusionBuffer();
+    if (!m_arrSampleQueries[0])
+        glGenQueries(2, m_arrSampleQueries);
+}
+
+// ********************************************************************
+void WorldRenderer::Shutdown() {
+    delete m_pQuadVAO;
+    m_pQuadVAO = nullptr;
+    delete m_pQuadIBO;
+    m_pQuadIBO = nullptr;
+    delete m_pDrawIdVBO;
+    m_pDrawIdVBO = nullptr;
+    delete m_pDrawCommandBuffer;
+    m_pDrawCommandBuffer = nullptr;
+    delete m_pDrawDataBuffer;
+    m_pDrawDataBuffer = nullptr;
+    m_iDrawCapacity = 0;
+    delete m_pThermalUploadRing;
+    m_pThermalUploadRing = nullptr;
+    delete m_pThermalAtlas;
+    m_pThermalAtlas = nullptr;
+    delete m_pOcclusionBuffer;
+    m_pOcclusionBuffer = nullptr;
+    if (m_arrSampleQueries[0])
+        glDeleteQueries(2, m_arrSampleQueries);
+    m_arrSampleQueries[0] = m_arrSampleQueries[1] = 0;
+    m_arrSampleQueryPending[0] = m_arrSampleQueryPending[1] = false;
+    m_uiLastSamplesPassed = 0;
+}
+
+// ********************************************************************
+int WorldRenderer::GetLastThermalUploads() {
+    return m_pThermalUploadRing ? m_pThermalUploadRing->GetLastFrameUploads() : 0;
+}
+
+// ********************************************************************
+int WorldRenderer::GetThermalSlotCount() {
+    return m_pThermalAtlas ? m_pThermalAtlas->GetUsedSlotCount() : 0;
+}
+
+// ********************************************************************
+int WorldRenderer::GetLastChunkDrawCount() {
+    return static_cast<int>(m_vecDrawCommands.size());
+}
+
+// ********************************************************************
+double WorldRenderer::GetLastCullingMs() {
+    return m_dLastCullingMs;
+}
+
+// ********************************************************************
+int WorldRenderer::GetLastOccludedChunkCount() {
+    return m_iLastOccludedChunks;
+}
+
+// ********************************************************************
+double WorldRenderer::GetLastOcclusionMs() {
+    return m_dLastOcclusionMs;
+}
+
+// ********************************************************************
+double WorldRenderer::GetLastDrawSortMs() {
+    return m_dLastDrawSortMs;
+}
+
+// ********************************************************************
+uint64_t WorldRenderer::GetLastSamplesPassed() {
+    return m_uiLastSamplesPassed;
+}
+
+// ********************************************************************
+size_t WorldRenderer::cullOccludedChunks(const ChunkBoundsTable &objBounds,
+                                         const Core::Mat4 &objViewProjection,
+                                         size_t iNbVisible) {
+    const BoxArraySoA objBoxes = objBounds.GetBoxes();
+    auto GetBox = [&objBoxes](uint32_t uiIndex) {
+        return AABB(Core::Vec3(objBoxes.m_pfMinX[uiIndex],
+                               objBoxes.m_pfMinY[uiIndex],
+                               objBoxes.m_pfMinZ[uiIndex]),
+                    Core::Vec3(objBoxes.m_pfMaxX[uiIndex],
+                               objBoxes.m_pfMaxY[uiIndex],
+                               objBoxes.m_pfMaxZ[uiIndex]));
+    };
+
+    // Nearest chunks first, by the clip-space w of their box centers
+    const float *e = objViewProjection.m_fElements;
+    m_vecOccluderOrder.clear();
+    for (size_t i = 0; i < iNbVisible; ++i) {
+        const uint32_t uiIndex = m_vecVisibleIndices[i];
+        const Core::Vec3 objCenter = GetBox(uiIndex).GetCenter();
+        const float fClipW = e[3] * objCenter.x + e[7] * objCenter.y + e[11] * objCenter.z + e[15];
+        m_vecOccluderOrder.push_back({fClipW, uiIndex});
+    }
+    const size_t iNbOccluders = std::min(iNbVisible, OCCLUDER_CHUNKS);
+    std::partial_sort(m_vecOccluderOrder.begin(),
+                      m_vecOccluderOrder.begin() + static_cast<std::ptrdiff_t>(iNbOccluders),
+                      m_vecOccluderOrder.end());
+
+    m_pOcclusionBuffer->Begin(objViewProjection);
+    for (size_t i = 0; i < iNbOccluders; ++i) {
+        const Chunk *pChunk = objBounds.GetChunk(m_vecOccluderOrder[i].second);
+        // A coarse mesh LOD may draw the ground below the blocks the heights come from
+        if (pChunk->GetMeshLod() > 0 || pChunk->GetUploadedMeshLod() > 0)
+            continue;
+        const auto fWorldX = static_cast<float>(pChunk->GetChunkX() * CHUNK_SIZE);
+        const auto fWorldZ = static_cast<float>(pChunk->GetChunkZ() * CHUNK_SIZE);
+        // Cells beyond the chunk's edges count as empty: their side of the column is drawn
+        auto GetHeight = [pChunk](int iCellX, int iCellZ) {
+            const bool bInside = iCellX >= 0 && iCellX < OCCLUDER_CELLS && iCellZ >= 0 &&
+                                 iCellZ < OCCLUDER_CELLS;
+            return bInside ? static_cast<float>(pChunk->GetOccluderHeight(iCellX, iCellZ)) : 0.0f;
+        };
+        for (int iCellX = 0; iCellX < OCCLUDER_CELLS; ++iCellX) {
+            for (int iCellZ = 0; iCellZ < OCCLUDER_CELLS; ++iCellZ) {
+                const float fHeight = GetHeight(iCellX, iCellZ);
+                if (fHeight == 0.0f)
+                    continue;
+                const float arrNeighbourHeights[4] = {GetHeight(iCellX - 1, iCellZ),
+                                                      GetHeight(iCellX + 1, iCellZ),
+                                                      GetHeight(iCellX, iCellZ - 1),
+                                                      GetHeight(iCellX, iCellZ + 1)};
+                const float fMinX = fWorldX + static_cast<float>(iCellX * OCCLUDER_CELL_SIZE);
+                const float fMinZ = fWorldZ + static_cast<float>(iCellZ * OCCLUDER_CELL_SIZE);
+                const AABB objColumn(Core::Vec3(fMinX, 0.0f, fMinZ),
+                                     Core::Vec3(fMinX + OCCLUDER_CELL_SIZE,
+                                                fHeight,
+                                                fMinZ + OCCLUDER_CELL_SIZE));
+                m_pOcclusionBuffer->AddOccluderColumn(objColumn, arrNeighbourHeights);
+            }
+        }
+    }
+
+    // Every visible chunk is tested, occluders included: a chunk's own cells are never nearer
+    // than its box's nearest corner, so it cannot hide itself
+    size_t iNbShown = 0;
+    for (size_t i = 0; i < iNbVisible; ++i) {
+        const uint32_t uiIndex = m_vecVisibleIndices[i];
+        if (!m_pOcclusionBuffer->IsOccluded(GetBox(uiIndex)))
+            m_vecVisibleIndices[iNbShown++] = uiIndex;
+    }
+    return iNbShown;
+}
+
+// ********************************************************************
+void WorldRenderer::reserveDraws(size_t iNbDraws) {
+    if (iNbDraws <= m_iDrawCapacity)
+        return;
+    m_iDrawCapacity = std::max(iNbDraws, 2 * m_iDrawCapacity);
+    std::vector<uint32_t> vecDrawIds(m_iDrawCapacity);
+    std::iota(vecDrawIds.begin(), vecDrawIds.end(), 0u);
+
+    delete m_pDrawIdVBO;
+    delete m_pDrawCommandBuffer;
+    delete m_pDrawDataBuffer;
+    m_pDrawIdVBO = new VertexBuffer(
+        vecDrawIds.data(), static_cast<unsigned int>(vecDrawIds.size() * sizeof(uint32_t)));
+    m_pQuadVAO->LinkIntegerAttribute(*m_pDrawIdVBO, 0, 1, GL_UNSIGNED_INT, sizeof(uint32_t), 1);
+    const auto uiCommandBytes =
+        static_cast<unsigned int>(m_iDrawCapacity * sizeof(DrawElementsIndirectCommand));
+    m_pDrawCommandBuffer = new StorageBuffer(nullptr, 0, uiCommandBytes);
+    const auto uiDataBytes = static_cast<unsigned int>(m_iDrawCapacity * sizeof(ChunkDrawData));
+    m_pDrawDataBuffer = new StorageBuffer(nullptr, 0, uiDataBytes);
+}
+
 // ********************************************************************
 void WorldRenderer::DrawAxes(const Core::Mat4 &objViewProjection, float fLength) {
     glDisable(GL_DEPTH_TEST);  // Draw on top of everything
@@ -28,11 +250,55 @@ void WorldRenderer::DrawAxes(const Core::Mat4 &objViewProjection, float fLength)
     glEnable(GL_DEPTH_TEST);
 }
 
+// ********************************************************************
+void WorldRenderer::getCameraPoint(const Core::Mat4 &objViewProjection, double arrEye[4]) {
+    // The eye is where clip x, y and w all vanish: the null vector of rows 0, 1 and 3, found as
+    // their 4D cross product (cofactors along a fourth row)
+    const float *e = objViewProjection.m_fElements;
+    const double a[4] = {e[0], e[4], e[8], e[12]};
+    const double b[4] = {e[1], e[5], e[9], e[13]};
+    const double c[4] = {e[3], e[7], e[11], e[15]};
+    auto Minor = [&](int i, int j, int k) {
+        return a[i] * (b[j] * c[k] - b[k] * c[j]) - a[j] * (b[i] * c[k] - b[k] * c[i]) +
+               a[k] * (b[i] * c[j] - b[j] * c[i]);
+    };
+    arrEye[0] = Minor(1, 2, 3);
+    arrEye[1] = -Minor(0, 2, 3);
+    arrEye[2] = Minor(0, 1, 3);
+    arrEye[3] = -Minor(0, 1, 2);
+    // Scale sign: the eye lies behind the near plane (clip z < 0), which makes w >= 0
+    const double dClipZ =
+        e[2] * arrEye[0] + e[6] * arrEye[1] + e[10] * arrEye[2] + e[14] * arrEye[3];
+    if (dClipZ > 0.0) {
+        for (int i = 0; i < 4; ++i) arrEye[i] = -arrEye[i];
+    }
+}
+
+// ********************************************************************
+unsigned int WorldRenderer::getFacingDirections(const double arrEye[4], const AABB &objBox) {
+    // A face of normal +X on the plane x = p faces the eye if eye.x - p * eye.w > 0: some face in
+    // the box can, unless that fails already at p = min.x (and likewise for the other five)
+    const double arrMin[3] = {objBox.m_objMinPt.x, objBox.m_objMinPt.y, objBox.m_objMinPt.z};
+    const double arrMax[3] = {objBox.m_objMaxPt.x, objBox.m_objMaxPt.y, objBox.m_objMaxPt.z};
+    // Per axis, the FaceDirection drawn with a positive and a negative normal (FACE_LAYOUTS)
+    constexpr int AXIS_DIRECTIONS[3][2] = {{RIGHT, LEFT}, {UP, DOWN}, {FRONT, BACK}};
+    unsigned int uiMask = 0;
+    for (int iAxis = 0; iAxis < 3; ++iAxis) {
+        if (arrEye[iAxis] - arrMin[iAxis] * arrEye[3] > 0.0)
+            uiMask |= 1u << AXIS_DIRECTIONS[iAxis][0];
+        if (arrEye[iAxis] - arrMax[iAxis] * arrEye[3] < 0.0)
+            uiMask |= 1u << AXIS_DIRECTIONS[iAxis][1];
+    }
+    return uiMask;
+}
+
 // ********************************************************************
 void WorldRenderer::DrawChunks(ChunkManager &objChunkManager,
                                Renderer::Shader &shader,
                                const Core::Mat4 &objViewProjection,
-                               bool bEnableFrustumCulling) {
+                               bool bEnableFrustumCulling,
+                               bool bEnableOcclusionCulling,
+                               bool bEnableFrontToBack) {
     shader.Use();
     shader.SetMat4("uViewProjection", objViewProjection);
 
@@ -43,26 +309,140 @@ void WorldRenderer::DrawChunks(ChunkManager &objChunkManager,
     objChunkManager.ResetUploadedVertCount();
     objChunkManager.ResetUploadedTriaCount();
 
-    for (const auto &[Coords, pChunk] : objChunkManager.GetMutableChunks()) {
-        if (bEnableFrustumCulling) {
-            if (!objFrustum.IsBoxInVisibleFrustum(pChunk->GetAABB())) {
+    // Batch test of the cached chunk boxes (8 per AVX2 iteration), no chunk is touched
+    auto tCullStart = std::chrono::steady_clock::now();
+    const ChunkBoundsTable &objBounds = objChunkManager.GetChunkBounds();
+    m_vecVisibleIndices.resize(objBounds.GetCount());
+    size_t iNbVisible = objBounds.GetCount();
+    if (bEnableFrustumCulling)
+        iNbVisible = objFrustum.CullBoxes(objBounds.GetBoxes(), m_vecVisibleIndices.data());
+    else
+        std::iota(m_vecVisibleIndices.begin(), m_vecVisibleIndices.end(), 0u);
+    auto tCullEnd = std::chrono::steady_clock::now();
+    m_dLastCullingMs = std::chrono::duration<double, std::milli>(tCullEnd - tCullStart).count();
+
+    // Software occlusion: hidden chunks are neither drawn nor counted as uploaded
+    m_iLastOccludedChunks = 0;
+    m_dLastOcclusionMs = 0.0;
+    if (bEnableOcclusionCulling && m_pOcclusionBuffer && iNbVisible > 0) {
+        auto tOcclusionStart = std::chrono::steady_clock::now();
+        const size_t iNbShown = cullOccludedChunks(objBounds, objViewProjection, iNbVisible);
+        m_iLastOccludedChunks = static_cast<int>(iNbVisible - iNbShown);
+        iNbVisible = iNbShown;
+        auto tOcclusionEnd = std::chrono::steady_clock::now();
+        m_dLastOcclusionMs =
+            std::chrono::duration<double, std::milli>(tOcclusionEnd - tOcclusionStart).count();
+    }
+
+    // Nearest first: the commands follow this order, and so do the thermal uploads (the nearest
+    // get the ring's budget)
+    m_dLastDrawSortMs = 0.0;
+    if (bEnableFrontToBack) {
+        auto tSortStart = std::chrono::steady_clock::now();
+        m_objDrawListSorter.SortFrontToBack(
+            objBounds.GetBoxes(), objViewProjection, m_vecVisibleIndices.data(), iNbVisible);
+        auto tSortEnd = std::chrono::steady_clock::now();
+        m_dLastDrawSortMs =
+            std::chrono::duration<double, std::milli>(tSortEnd - tSortStart).count();
+    }
+
+    // Thermal uploads first: a growing atlas changes texture, so it is bound once they are done.
+    // Only chunks whose thermal generation moved upload, streamed through the ring
+    if (m_pThermalAtlas) {
+        if (m_pThermalUploadRing)
+            m_pThermalUploadRing->BeginFrame();
+        for (size_t i = 0; i < iNbVisible; ++i) {
+            objBounds.GetChunk(m_vecVisibleIndices[i])
+                ->UpdateThermalTexture(*m_pThermalAtlas, m_pThermalUploadRing);
+        }
+        if (m_pThermalUploadRing)
+            m_pThermalUploadRing->EndFrame();
+
+        m_pThermalAtlas->Bind(1);
+        shader.SetIVec2("u_ThermalAtlasGrid",
+                        m_pThermalAtlas->GetGridX(),
+                        m_pThermalAtlas->GetGridY());
+    }
+
+    // One indirect command per run of adjacent face directions turned to the camera (the mesh
+    // stores them one after the other): its faces start at word baseVertex / 4 of the arena (the
+    // shader reads face gl_VertexID / 4), and its draw data at index baseInstance. Only submitted
+    // faces count as uploaded
+    double arrEye[4];
+    getCameraPoint(objViewProjection, arrEye);
+    m_vecDrawCommands.clear();
+    m_vecDrawData.clear();
+    for (size_t i = 0; i < iNbVisible; ++i) {
+        const Chunk *pChunk = objBounds.GetChunk(m_vecVisibleIndices[i]);
+        if (pChunk->GetMeshFaceCount() == 0)
+            continue;
+        const unsigned int uiFacing = getFacingDirections(arrEye, pChunk->GetAABB());
+        int iDir = FRONT;
+        while (iDir <= DOWN) {
+            if (!(uiFacing & (1u << iDir))) {
+                ++iDir;
                 continue;
             }
+            const unsigned int uiFirstFace = pChunk->GetMeshDirectionStart(iDir);
+            while (iDir <= DOWN && (uiFacing & (1u << iDir))) ++iDir;
+            const unsigned int uiNbFaces = pChunk->GetMeshDirectionStart(iDir) - uiFirstFace;
+            if (uiNbFaces == 0)
+                continue;
+            objChunkManager.AddToUploadedVertCount(static_cast<size_t>(uiNbFaces) * 4);
+            objChunkManager.AddToUploadedTriaCount(static_cast<size_t>(uiNbFaces) * 2);
+
+            const auto uiDrawIndex = static_cast<uint32_t>(m_vecDrawCommands.size());
+            const auto iBaseVertex = static_cast<int32_t>(uiFirstFace * 4);
+            m_vecDrawCommands.push_back({uiNbFaces * 6, 1, 0, iBaseVertex, uiDrawIndex});
+            // No texture rebind per draw: the draw only selects its slot (-1 samples as cold)
+            m_vecDrawData.push_back({static_cast<float>(pChunk->GetChunkX() * CHUNK_SIZE),
+                                     static_cast<float>(pChunk->GetChunkZ() * CHUNK_SIZE),
+                                     m_pThermalAtlas ? pChunk->GetThermalSlot() : -1,
+                                     0});
+        }
+    }
+
+    const Renderer::GeometryArena *pArena = objChunkManager.GetGeometryArena();
+    if (!pArena || !m_pQuadVAO || m_vecDrawCommands.empty())
+        return;
+    reserveDraws(m_vecDrawCommands.size());
+    m_pDrawCommandBuffer->Update(
+        m_vecDrawCommands.data(),
+        static_cast<unsigned int>(m_vecDrawCommands.size() * sizeof(DrawElementsIndirectCommand)));
+    m_pDrawDataBuffer->Update(
+        m_vecDrawData.data(),
+        static_cast<unsigned int>(m_vecDrawData.size() * sizeof(ChunkDrawData)));
+
+    pArena->BindBase(0);
+    m_pDrawDataBuffer->BindBase(2);
+    m_pQuadVAO->Bind();
+    m_pDrawCommandBuffer->Bind(GL_DRAW_INDIRECT_BUFFER);
+    const bool bCountSamples = m_arrSampleQueries[0] != 0;
+    if (bCountSamples)
+        glBeginQuery(GL_SAMPLES_PASSED, m_arrSampleQueries[m_iSampleQuery]);
+    glMultiDrawElementsIndirect(GL_TRIANGLES,
+                                GL_UNSIGNED_INT,
+                                nullptr,
+                                static_cast<GLsizei>(m_vecDrawCommands.size()),
+                                0);
+    if (bCountSamples) {
+        glEndQuery(GL_SAMPLES_PASSED);
+        m_arrSampleQueryPending[m_iSampleQuery] = true;
+        // The other query's result, if the GPU is done with it (never waits)
+        m_iSampleQuery ^= 1;
+        const unsigned int uiQuery = m_arrSampleQueries[m_iSampleQuery];
+        GLuint uiAvailable = GL_FALSE;
+        if (m_arrSampleQueryPending[m_iSampleQuery])
+            glGetQueryObjectuiv(uiQuery, GL_QUERY_RESULT_AVAILABLE, &uiAvailable);
+        if (uiAvailable) {
+            GLuint64 uiSamples = 0;
+            glGetQueryObjectui64v(uiQuery, GL_QUERY_RESULT, &uiSamples);
+            m_uiLastSamplesPassed = uiSamples;
+            m_arrSampleQueryPending[m_iSampleQuery] = false;
         }
-        float fChunkX = static_cast<float>(pChunk->GetChunkX() * CHUNK_SIZE);
-        float fChunkZ = static_cast<float>(pChunk->GetChunkZ() * CHUNK_SIZE);
-        Core::Vec3 vChunkOffset(fChunkX, fChunkZ, 0.0f);
-        shader.SetVec2("u_ChunkOffset", vChunkOffset);
-
-        pChunk->UpdateThermalTexture();
-        pChunk->Bind(1);
-        pChunk->Render();
-
-        size_t iNbVertices = 0, iNbTriangles = 0;
-        pChunk->GetMeshStats(iNbVertices, iNbTriangles);
-        objChunkManager.AddToUploadedVertCount(iNbVertices);
-        objChunkManager.AddToUploadedTriaCount(iNbTriangles);
     }
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+    m_pQuadVAO->Unbind();
 }
 
 }  // namespace Renderer
\ No newline at end of file
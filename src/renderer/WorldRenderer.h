@@ -1,8 +1,16 @@
 #pragma once
 
 #include "../core/Matrix.h"
+#include <cstdint>
+#include <utility>
+#include <vector>
 #include "../world/ChunkManager.h"
+#include "DrawListSorter.h"
+#include "OcclusionBuffer.h"
 #include "Shader.h"
+#include "StorageBuffer.h"
+#include "ThermalUploadRing.h"
+#include "VertexArray.h"
 
 namespace Renderer {
 
@@ -12,6 +20,18 @@ namespace Renderer {
  */
 class WorldRenderer {
 public:
+    /**
+     * @brief Creates the shared quad index buffer, the thermal atlas and its upload ring. Must be
+     * called after the OpenGL context is created and before any chunk is drawn.
+     */
+    static void Init();
+
+    /**
+     * @brief Releases the quad index buffer, the atlas and the upload ring (after the chunks,
+     * before the context goes away).
+     */
+    static void Shutdown();
+
     /**
      * @brief Draws the RGB coordinate axes at the origin.
      * @param objViewProjection Camera VP Matrix.
@@ -20,15 +40,146 @@ public:
     static void DrawAxes(const Core::Mat4 &objViewProjection, float fLength = 50.0f);
 
     /**
-     * @brief Renders the voxel world chunks.
+     * @brief Renders the voxel world chunks with one glMultiDrawElementsIndirect over the
+     * ChunkManager's geometry arena. Each visible chunk submits only the face directions that can
+     * face the camera from somewhere in its box, one command per run of adjacent directions.
+     * Every chunk shares the same shader, buffers and textures, so the only ordering that matters
+     * is by depth.
      * @param objChunkManager The world manager containing chunks.
      * @param shader The main voxel shader.
      * @param objViewProjection Camera VP Matrix.
      * @param bEnableFrustumCulling If true, skips chunks outside the camera view.
+     * @param bEnableOcclusionCulling If true, also skips chunks hidden behind the solid ground of
+     * the nearest chunks (tested on the CPU, see OcclusionBuffer).
+     * @param bEnableFrontToBack If true, issues the visible chunks nearest first (see
+     * DrawListSorter) so that the depth test rejects the fragments of the far ones.
      */
     static void DrawChunks(ChunkManager &objChunkManager,
                            Renderer::Shader &shader,
                            const Core::Mat4 &objViewProjection,
-                           bool bEnableFrustumCulling = false);
+                           bool bEnableFrustumCulling = false,
+                           bool bEnableOcclusionCulling = false,
+                           bool bEnableFrontToBack = false);
+
+    /**
+     * @brief Thermal textures streamed by the last DrawChunks call.
+     */
+    static int GetLastThermalUploads();
+
+    /**
+     * @brief Atlas slots held by heated chunks.
+     */
+    static int GetThermalSlotCount();
+
+    /**
+     * @brief Indirect commands issued by the last DrawChunks call (all in one draw call).
+     */
+    static int GetLastChunkDrawCount();
+
+    /**
+     * @brief CPU time of the last DrawChunks call's frustum culling.
+     */
+    static double GetLastCullingMs();
+
+    /**
+     * @brief Chunks inside the frustum that the last DrawChunks call found occluded.
+     */
+    static int GetLastOccludedChunkCount();
+
+    /**
+     * @brief CPU time of the last DrawChunks call's occlusion culling (rasterisation and tests).
+     */
+    static double GetLastOcclusionMs();
+
+    /**
+     * @brief CPU time of the last DrawChunks call's front-to-back sort.
+     */
+    static double GetLastDrawSortMs();
+
+    /**
+     * @brief Samples of the chunk draw that passed the depth test (GL_SAMPLES_PASSED), about the
+     * fragments shaded. Read without stalling: the result trails by a frame or two, and stays 0
+     * until a query completes.
+     */
+    static uint64_t GetLastSamplesPassed();
+
+private:
+    // Chunks pull their faces from storage buffers: the only vertex state is one index buffer of
+    // 0,1,2 2,3,0 quads (offset by 4 per quad) shared by every chunk draw
+    static VertexArray* m_pQuadVAO;
+    static IndexBuffer* m_pQuadIBO;
+
+    /**
+     * @struct DrawElementsIndirectCommand
+     * @brief Layout read by glMultiDrawElementsIndirect.
+     */
+    struct DrawElementsIndirectCommand {
+        uint32_t m_uiCount;
+        uint32_t m_uiInstanceCount;
+        uint32_t m_uiFirstIndex;
+        int32_t m_iBaseVertex;
+        uint32_t m_uiBaseInstance;
+    };
+    /**
+     * @struct ChunkDrawData
+     * @brief Per-draw record of the ChunkDraws storage block (std430), indexed by the draw ID.
+     */
+    struct ChunkDrawData {
+        float m_fOffsetX;
+        float m_fOffsetZ;
+        int32_t m_iThermalSlot;  // -1: cold chunk, nothing to sample
+        int32_t m_iPadding;
+    };
+
+    // Each command's baseInstance is its draw index; it reaches the shader through an instanced
+    // attribute (divisor 1) over 0, 1, 2, ... since gl_DrawID needs GL 4.6. The three buffers
+    // hold m_iDrawCapacity draws and are recreated twice as large when a frame needs more
+    static void reserveDraws(size_t iNbDraws);
+    static size_t m_iDrawCapacity;
+    static VertexBuffer* m_pDrawIdVBO;
+    static StorageBuffer* m_pDrawCommandBuffer;
+    static StorageBuffer* m_pDrawDataBuffer;
+    // Rebuilt every frame, kept to reuse their capacity
+    static std::vector<DrawElementsIndirectCommand> m_vecDrawCommands;
+    static std::vector<ChunkDrawData> m_vecDrawData;
+    static std::vector<uint32_t> m_vecVisibleIndices;
+    static double m_dLastCullingMs;
+
+    // Camera position as a homogeneous point (w = 0 for an orthographic view: the direction
+    // towards the camera), the point the view projection maps onto the eye
+    static void getCameraPoint(const Core::Mat4 &objViewProjection, double arrEye[4]);
+    // Bit d set if some face of FaceDirection d inside the box can be turned to the camera
+    static unsigned int getFacingDirections(const double arrEye[4], const AABB &objBox);
+
+    // The nearest OCCLUDER_CHUNKS visible chunks are rasterised as occluders, one column per
+    // occluder cell; the first iNbVisible visible indices are then filtered in place
+    static constexpr size_t OCCLUDER_CHUNKS = 16;
+    static size_t cullOccludedChunks(const ChunkBoundsTable &objBounds,
+                                     const Core::Mat4 &objViewProjection,
+                                     size_t iNbVisible);
+    static OcclusionBuffer* m_pOcclusionBuffer;
+    static std::vector<std::pair<float, uint32_t>> m_vecOccluderOrder;  // Clip w, bounds index
+    static int m_iLastOccludedChunks;
+    static double m_dLastOcclusionMs;
+
+    static DrawListSorter m_objDrawListSorter;
+    static double m_dLastDrawSortMs;
+
+    // Two GL_SAMPLES_PASSED queries used in turn: each frame counts its draw with one and reads
+    // the other (issued the frame before) if its result is available
+    static unsigned int m_arrSampleQueries[2];
+    static bool m_arrSampleQueryPending[2];
+    static int m_iSampleQuery;
+    static uint64_t m_uiLastSamplesPassed;
+
+    // Budget of one frame: ~180 FP32 chunk fields, the rest wait for the next frame
+    static constexpr size_t THERMAL_UPLOAD_SEGMENT_BYTES = 4u << 20;
+    static ThermalUploadRing* m_pThermalUploadRing;
+
+    // 8 x 8 x 4 slots (256 chunks, 6 MB) to start with, doubled along Z on demand
+    static constexpr int THERMAL_ATLAS_GRID_X = 8;
+    static constexpr int THERMAL_ATLAS_GRID_Y = 8;
+    static constexpr int THERMAL_ATLAS_GRID_Z = 4;
+    static ThermalAtlas* m_pThermalAtlas;
 };
 }  // namespace Renderer
\ No newline at end of file
@@ -15,32 +15,438 @@
 #endif
 
 #include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
 #include <cstring>
 #include <iostream>
 #include "Chunk.h"
 
+namespace {
+// Segments of a temporal-blocking tile row held at 0 K (see Chunk::gatherTile)
+constexpr uint8_t TILE_PIN_WEST = 1;
+constexpr uint8_t TILE_PIN_ROW = 2;
+constexpr uint8_t TILE_PIN_EAST = 4;
+
+// Row transfers between a stored field and an FP32 tile
+void loadRow(float* pfDst, const float* pfSrc, int iCount) {
+    std::memcpy(pfDst, pfSrc, static_cast<size_t>(iCount) * sizeof(float));
+}
+void loadRow(float* pfDst, const HalfFloat* puiSrc, int iCount) {
+    ThermalKernels::ConvertToFloat(puiSrc, pfDst, iCount);
+}
+void storeRow(float* pfDst, const float* pfSrc, int iCount) {
+    std::memcpy(pfDst, pfSrc, static_cast<size_t>(iCount) * sizeof(float));
+}
+void storeRow(HalfFloat* puiDst, const float* pfSrc, int iCount) {
+    ThermalKernels::ConvertToHalf(pfSrc, puiDst, iCount);
+}
+float toFloat(float fValue) {
+    return fValue;
+}
+float toFloat(HalfFloat uiValue) {
+    return ThermalKernels::HalfToFloat(uiValue);
+}
+
+// Coarse field layout of a chunk at LOD iLod: cells per axis and padded index
+int getCoarseSize(int iLod) {
+    return CHUNK_SIZE >> iLod;
+}
+int getCoarseHeight(int iLod) {
+    return CHUNK_HEIGHT >> iLod;
+}
+int getCoarseIndex(int iLod, int iX, int iY, int iZ) {
+    const int iPaddedSize = getCoarseSize(iLod) + 2;
+    const int iPaddedHeight = getCoarseHeight(iLod) + 2;
+    return (iX + 1) + (iY + 1) * iPaddedSize + (iZ + 1) * iPaddedSize * iPaddedHeight;
+}
+
+// Calls fnVisit(iX, iY, iZ) for every boundary cell of an iSizeX x iSizeY x iSizeZ grid on the
+// face towards iDir
+template <typename Fn>
+void forEachFaceCell(Direction iDir, int iSizeX, int iSizeY, int iSizeZ, Fn&& fnVisit) {
+    switch (iDir) {
+        case Direction::WEST:
+        case Direction::EAST: {
+            const int iX = iDir == Direction::WEST ? 0 : iSizeX - 1;
+            for (int iZ = 0; iZ < iSizeZ; ++iZ)
+                for (int iY = 0; iY < iSizeY; ++iY) fnVisit(iX, iY, iZ);
+            break;
+        }
+        case Direction::BELOW:
+        case Direction::ABOVE: {
+            const int iY = iDir == Direction::BELOW ? 0 : iSizeY - 1;
+            for (int iZ = 0; iZ < iSizeZ; ++iZ)
+                for (int iX = 0; iX < iSizeX; ++iX) fnVisit(iX, iY, iZ);
+            break;
+        }
+        case Direction::SOUTH:
+        case Direction::NORTH: {
+            const int iZ = iDir == Direction::SOUTH ? 0 : iSizeZ - 1;
+            for (int iY = 0; iY < iSizeY; ++iY)
+                for (int iX = 0; iX < iSizeX; ++iX) fnVisit(iX, iY, iZ);
+            break;
+        }
+    }
+}
+
+// Outward unit offset of each face, indexed by Direction
+constexpr int FACE_NORMALS[6][3] = {{0, 0, 1}, {0, 0, -1}, {1, 0, 0},
+                                    {-1, 0, 0}, {0, 1, 0}, {0, -1, 0}};
+
+// Mesh face geometry, indexed by FaceDirection. Corner offsets are in {0, 1} per axis and scale
+// with the quad's extent; the meshers' rows run along m_iAxisU/m_iAxisV (0 = X, 1 = Y, 2 = Z).
+// Corners keep the per-face mesher's order, so the winding is unchanged. vertex_Chunk.glsl holds
+// a copy of the corners and axes to expand packed faces, and maps the same axes to the texture
+// U/V (V flipped on UP/DOWN faces)
+struct FaceLayout {
+    int m_arrCorners[4][3];
+    int m_iAxisU, m_iAxisV;
+    int m_iNormal[3];
+};
+constexpr FaceLayout FACE_LAYOUTS[6] = {
+    {{{0, 0, 1}, {1, 0, 1}, {1, 1, 1}, {0, 1, 1}}, 0, 1, {0, 0, 1}},  // FRONT (Z+)
+    {{{0, 0, 0}, {0, 1, 0}, {1, 1, 0}, {1, 0, 0}}, 0, 1, {0, 0, -1}},  // BACK (Z-)
+    {{{0, 0, 0}, {0, 0, 1}, {0, 1, 1}, {0, 1, 0}}, 2, 1, {-1, 0, 0}},  // LEFT (X-)
+    {{{1, 0, 0}, {1, 1, 0}, {1, 1, 1}, {1, 0, 1}}, 2, 1, {1, 0, 0}},  // RIGHT (X+)
+    {{{0, 1, 0}, {0, 1, 1}, {1, 1, 1}, {1, 1, 0}}, 0, 2, {0, 1, 0}},  // UP (Y+)
+    {{{0, 0, 0}, {1, 0, 0}, {1, 0, 1}, {0, 0, 1}}, 0, 2, {0, -1, 0}},  // DOWN (Y-)
+};
+
+// Binary mesher: visible faces as bitmasks, per FaceDirection and slice along its normal, one row
+// per V coordinate with bit U set for every exposed face
+struct FacePlanes {
+    uint32_t m_arrRows[6][MESH_MAX_DIM][MESH_MAX_DIM];
+};
+
+// Cells the mesher walks: blocks at full resolution, cubes of 2^L blocks at mesh LOD L. Cells keep
+// the block layout (getBlockIndex), coarse ones packed into its low corner
+struct MeshGrid {
+    int m_arrDims[3];  // Cells per axis
+    int m_iScale;      // Blocks per cell along each axis
+};
+MeshGrid getMeshGrid(int iLod) {
+    return {{CHUNK_SIZE >> iLod, CHUNK_HEIGHT >> iLod, CHUNK_SIZE >> iLod}, 1 << iLod};
+}
+
+// Per-thread mesher workspace. The arrays only ever grow (to the largest face count this thread
+// has meshed), so steady-state meshing writes into memory it already owns
+struct MeshScratch {
+    FacePlanes m_objPlanes;
+    ChunkMeshInput m_objCoarseInput;  // Downsampled snapshot of a mesh LOD > 0
+    std::vector<ChunkFace> m_vecFaces;
+    size_t m_iNbQuads = 0;
+
+    void Reserve(size_t iNbQuads) {
+        if (m_vecFaces.size() < iNbQuads)
+            m_vecFaces.resize(iNbQuads);
+        m_iNbQuads = 0;
+    }
+};
+
+MeshScratch& getMeshScratch() {
+    static thread_local MeshScratch objScratch;
+    return objScratch;
+}
+
+int getBlockIndex(const int arrCell[3]) {
+    return arrCell[0] + (arrCell[1] * CHUNK_SIZE) + (arrCell[2] * CHUNK_SIZE * CHUNK_HEIGHT);
+}
+
+// Block type of the cell arrCell of objGrid (scale 1: the block itself). A coarse cell is solid
+// when at least half of its blocks are (majority), with the type of its topmost solid block (top
+// surface), so coarse terrain keeps its grass. Floor cells take any solid block: nothing below
+// them would show instead, thin ground would open onto the void
+uint8_t getCellBlock(const uint8_t* puiBlocks, const MeshGrid& objGrid, const int arrCell[3]) {
+    const int iScale = objGrid.m_iScale;
+    if (iScale == 1)
+        return puiBlocks[getBlockIndex(arrCell)];
+    int iNbSolid = 0;
+    uint8_t uiTopBlock = AIR;
+    int arrBlock[3];
+    for (int iY = iScale - 1; iY >= 0; --iY) {
+        arrBlock[1] = arrCell[1] * iScale + iY;
+        for (int iZ = 0; iZ < iScale; ++iZ) {
+            arrBlock[2] = arrCell[2] * iScale + iZ;
+            for (int iX = 0; iX < iScale; ++iX) {
+                arrBlock[0] = arrCell[0] * iScale + iX;
+                const uint8_t uiBlock = puiBlocks[getBlockIndex(arrBlock)];
+                if (uiBlock == AIR)
+                    continue;
+                ++iNbSolid;
+                if (uiTopBlock == AIR)
+                    uiTopBlock = uiBlock;
+            }
+        }
+    }
+    const bool bSolid =
+        2 * iNbSolid >= iScale * iScale * iScale || (arrCell[1] == 0 && iNbSolid > 0);
+    return bSolid ? uiTopBlock : static_cast<uint8_t>(AIR);
+}
+
+// Axis of a face normal (0 = X, 1 = Y, 2 = Z)
+int getNormalAxis(const int arrNormal[3]) {
+    int iAxis = 0;
+    while (arrNormal[iAxis] == 0) ++iAxis;
+    return iAxis;
+}
+
+int getAtlasTile(int iBlockType, FaceDirection iDir) {
+    // Texture Atlas Calculations
+    int iAtlasCol = 0, iAtlasRow = 0;
+
+    // Simple Texture Mapper
+    if (iBlockType == GRASS) {
+        if (iDir == FaceDirection::UP) {
+            iAtlasCol = 2;
+            iAtlasRow = 9;
+        }  // Grass Top
+        else if (iDir == FaceDirection::DOWN) {
+            iAtlasCol = 1;
+            iAtlasRow = 0;
+        }  // Stone
+        else {
+            iAtlasCol = 3;
+            iAtlasRow = 0;
+        }  // Grass Side
+    } else if (iBlockType == DIRT) {
+        iAtlasCol = 2;
+        iAtlasRow = 0;  // Dirt
+    } else if (iBlockType == STONE) {
+        iAtlasCol = 1;
+        iAtlasRow = 0;  // Stone
+    }
+    return iAtlasCol + iAtlasRow * TEXTURE_ATLAS_TILES;
+}
+
+void buildFacePlanes(const ChunkMeshInput& objInput,
+                     const MeshGrid& objGrid,
+                     bool bEnableNeighborCulling,
+                     FacePlanes& objPlanes) {
+    const int* arrDims = objGrid.m_arrDims;
+    // Occupancy columns along each axis A, indexed by the coordinates along A + 1 and A + 2
+    // (mod 3): bit i + 1 is cell i, bits 0 and Dim + 1 the neighbours' boundary cells
+    uint32_t arrCols[3][MESH_MAX_DIM][MESH_MAX_DIM] = {};
+    for (int iZ = 0; iZ < arrDims[2]; ++iZ) {
+        for (int iY = 0; iY < arrDims[1]; ++iY) {
+            const int arrRowStart[3] = {0, iY, iZ};
+            const uint8_t* puiRow = &objInput.m_arrBlocks[getBlockIndex(arrRowStart)];
+            for (int iX = 0; iX < arrDims[0]; ++iX) {
+                if (puiRow[iX] == AIR)
+                    continue;
+                arrCols[0][iY][iZ] |= 2u << iX;
+                arrCols[1][iZ][iX] |= 2u << iY;
+                arrCols[2][iX][iY] |= 2u << iZ;
+            }
+        }
+    }
+    if (bEnableNeighborCulling) {
+        // One-voxel border from the neighbours' snapshot (none: air, so the face stays visible)
+        for (int iDir = Direction::NORTH; iDir <= Direction::BELOW; ++iDir) {
+            const int iAxis = getNormalAxis(FACE_NORMALS[iDir]);
+            const bool bPositive = FACE_NORMALS[iDir][iAxis] > 0;
+            const uint32_t uiBorderBit = bPositive ? 1u << (arrDims[iAxis] + 1) : 1u;
+            const int iSizeP = arrDims[(iAxis + 1) % 3];
+            for (int iP = 0; iP < iSizeP; ++iP) {
+                for (uint32_t uiRow = objInput.m_arrBorders[iDir][iP]; uiRow; uiRow &= uiRow - 1)
+                    arrCols[iAxis][iP][std::countr_zero(uiRow)] |= uiBorderBit;
+            }
+        }
+    }
+
+    // Exposed faces per column: solid here and air on the face side, then scattered into the
+    // per-direction slice rows (bit U of row V) the emitters walk
+    std::memset(&objPlanes, 0, sizeof(objPlanes));
+    for (int iDir = FaceDirection::FRONT; iDir <= FaceDirection::DOWN; ++iDir) {
+        const FaceLayout& objLayout = FACE_LAYOUTS[iDir];
+        const int iAxisU = objLayout.m_iAxisU;
+        const int iAxisV = objLayout.m_iAxisV;
+        const int iAxis = 3 - iAxisU - iAxisV;
+        const bool bPositive = objLayout.m_iNormal[iAxis] > 0;
+        const int iAxisP = (iAxis + 1) % 3;
+        const int iAxisQ = (iAxis + 2) % 3;
+        const uint32_t uiInterior = (1u << arrDims[iAxis]) - 1u;
+
+        for (int iP = 0; iP < arrDims[iAxisP]; ++iP) {
+            for (int iQ = 0; iQ < arrDims[iAxisQ]; ++iQ) {
+                const uint32_t uiCol = arrCols[iAxis][iP][iQ];
+                uint32_t uiFaces = uiCol;
+                if (bEnableNeighborCulling)
+                    uiFaces &= bPositive ? ~(uiCol >> 1) : ~(uiCol << 1);
+                uiFaces = (uiFaces >> 1) & uiInterior;
+
+                int arrCell[3];
+                arrCell[iAxisP] = iP;
+                arrCell[iAxisQ] = iQ;
+                while (uiFaces) {
+                    arrCell[iAxis] = std::countr_zero(uiFaces);  // tzcnt
+                    uiFaces &= uiFaces - 1;
+                    const uint32_t uiBit = 1u << arrCell[iAxisU];
+                    objPlanes.m_arrRows[iDir][arrCell[iAxis]][arrCell[iAxisV]] |= uiBit;
+                }
+            }
+        }
+    }
+}
+
+// Writes quad m_iNbQuads in place; MeshScratch::Reserve() made room for every visible face.
+// Origin and size are in cells of objGrid
+void addQuad(MeshScratch& objScratch,
+             const MeshGrid& objGrid,
+             const int arrOrigin[3],
+             const int arrSize[3],
+             FaceDirection iDir,
+             int iAtlasTile) {
+    // In blocks: a face on the positive side of a coarse cell starts at the cell's last block,
+    // as the shader puts it one block past its origin
+    const FaceLayout& objLayout = FACE_LAYOUTS[iDir];
+    const int iScale = objGrid.m_iScale;
+    const int iAxis = 3 - objLayout.m_iAxisU - objLayout.m_iAxisV;
+    int arrBlockOrigin[3];
+    for (int i = 0; i < 3; ++i) arrBlockOrigin[i] = arrOrigin[i] * iScale;
+    if (objLayout.m_iNormal[iAxis] > 0)
+        arrBlockOrigin[iAxis] += iScale - 1;
+
+    // One record per quad: vertex_Chunk.glsl expands its corners (FACE_LAYOUTS order) and the
+    // shared quad index buffer turns them into two triangles
+    objScratch.m_vecFaces[objScratch.m_iNbQuads++] =
+        PackChunkFace(arrBlockOrigin[0],
+                      arrBlockOrigin[1],
+                      arrBlockOrigin[2],
+                      arrSize[objLayout.m_iAxisU] * iScale,
+                      arrSize[objLayout.m_iAxisV] * iScale,
+                      iDir,
+                      iAtlasTile);
+}
+
+void emitFaces(const ChunkMeshInput& objInput,
+               const MeshGrid& objGrid,
+               FaceDirection iDir,
+               const FacePlanes& objPlanes,
+               MeshScratch& objScratch) {
+    const FaceLayout& objLayout = FACE_LAYOUTS[iDir];
+    const int iAxisU = objLayout.m_iAxisU;
+    const int iAxisV = objLayout.m_iAxisV;
+    const int iAxis = 3 - iAxisU - iAxisV;
+    const int arrSize[3] = {1, 1, 1};
+
+    int arrCell[3];
+    for (int iSlice = 0; iSlice < objGrid.m_arrDims[iAxis]; ++iSlice) {
+        arrCell[iAxis] = iSlice;
+        for (int iV = 0; iV < objGrid.m_arrDims[iAxisV]; ++iV) {
+            arrCell[iAxisV] = iV;
+            for (uint32_t uiRow = objPlanes.m_arrRows[iDir][iSlice][iV]; uiRow;
+                 uiRow &= uiRow - 1) {
+                arrCell[iAxisU] = std::countr_zero(uiRow);
+                const uint8_t iBlockType = objInput.m_arrBlocks[getBlockIndex(arrCell)];
+                addQuad(objScratch,
+                        objGrid,
+                        arrCell,
+                        arrSize,
+                        iDir,
+                        getAtlasTile(iBlockType, iDir));
+            }
+        }
+    }
+}
+
+void emitGreedyFaces(const ChunkMeshInput& objInput,
+                     const MeshGrid& objGrid,
+                     FaceDirection iDir,
+                     const FacePlanes& objPlanes,
+                     MeshScratch& objScratch) {
+    const FaceLayout& objLayout = FACE_LAYOUTS[iDir];
+    const int iAxisU = objLayout.m_iAxisU;
+    const int iAxisV = objLayout.m_iAxisV;
+    const int iAxis = 3 - iAxisU - iAxisV;
+    const int iSizeV = objGrid.m_arrDims[iAxisV];
+
+    auto TileAt = [&](int iSlice, int iU, int iV) {
+        int arrCell[3];
+        arrCell[iAxis] = iSlice;
+        arrCell[iAxisU] = iU;
+        arrCell[iAxisV] = iV;
+        return getAtlasTile(objInput.m_arrBlocks[getBlockIndex(arrCell)], iDir);
+    };
+    // Every cell of run uiRun in row iV has tile iTile
+    auto RunHasTile = [&](int iSlice, int iV, uint32_t uiRun, int iTile) {
+        for (; uiRun; uiRun &= uiRun - 1) {
+            if (TileAt(iSlice, std::countr_zero(uiRun), iV) != iTile)
+                return false;
+        }
+        return true;
+    };
+
+    for (int iSlice = 0; iSlice < objGrid.m_arrDims[iAxis]; ++iSlice) {
+        uint32_t arrRows[MESH_MAX_DIM];
+        std::memcpy(arrRows, objPlanes.m_arrRows[iDir][iSlice], sizeof(arrRows));
+
+        for (int iV = 0; iV < iSizeV; ++iV) {
+            while (arrRows[iV]) {
+                // Grow the lowest face along U while the bits are set and the tile matches...
+                const int iU = std::countr_zero(arrRows[iV]);
+                const int iTile = TileAt(iSlice, iU, iV);
+                int iWidth = 1;
+                while (((arrRows[iV] >> (iU + iWidth)) & 1u) &&
+                       TileAt(iSlice, iU + iWidth, iV) == iTile)
+                    ++iWidth;
+                const uint32_t uiRun = ((1u << iWidth) - 1u) << iU;
+
+                // ...then along V while the next row holds the whole run with the same tile
+                int iHeight = 1;
+                while (iV + iHeight < iSizeV && (arrRows[iV + iHeight] & uiRun) == uiRun &&
+                       RunHasTile(iSlice, iV + iHeight, uiRun, iTile))
+                    ++iHeight;
+                for (int iRow = 0; iRow < iHeight; ++iRow) arrRows[iV + iRow] &= ~uiRun;
+
+                int arrOrigin[3];
+                int arrSize[3] = {1, 1, 1};
+                arrOrigin[iAxis] = iSlice;
+                arrOrigin[iAxisU] = iU;
+                arrOrigin[iAxisV] = iV;
+                arrSize[iAxisU] = iWidth;
+                arrSize[iAxisV] = iHeight;
+                addQuad(objScratch, objGrid, arrOrigin, arrSize, iDir, iTile);
+            }
+        }
+    }
+}
+}  // namespace
+
+//*********************************************************************
+void GetChunkFaceCorner(ChunkFace uiFace, int iCorner, int arrCorner[3]) {
+    const FaceLayout& objLayout = FACE_LAYOUTS[UnpackFaceDirection(uiFace)];
+    int arrSize[3] = {1, 1, 1};
+    arrSize[objLayout.m_iAxisU] = UnpackFaceSizeU(uiFace);
+    arrSize[objLayout.m_iAxisV] = UnpackFaceSizeV(uiFace);
+    for (int iAxis = 0; iAxis < 3; ++iAxis) {
+        arrCorner[iAxis] = UnpackFaceOrigin(uiFace, iAxis) +
+                           objLayout.m_arrCorners[iCorner][iAxis] * arrSize[iAxis];
+    }
+}
+
+//*********************************************************************
+template <>
+float* Chunk::getCurrField<float>() const {
+    return m_pfCurrFrameData;
+}
+//*********************************************************************
+template <>
+HalfFloat* Chunk::getCurrField<HalfFloat>() const {
+    return m_puiCurrFrameHalf;
+}
+
 //*********************************************************************
 Chunk::Chunk(int iX, int iZ) : m_iChunkX(iX), m_iChunkZ(iZ) {
-    size_t iRawBytes = PADDED_CHUNK_VOL * sizeof(float);
-    size_t iAlignedBytes = (iRawBytes + 63) & ~63;
-    m_pfCurrFrameData = static_cast<float*>(ALLOCATE_ALIGNED(iAlignedBytes, 64));
-    m_pfNextFrameData = static_cast<float*>(ALLOCATE_ALIGNED(iAlignedBytes, 64));
-    std::fill_n(m_pfCurrFrameData, PADDED_CHUNK_VOL, 0.0f);
-    std::fill_n(m_pfNextFrameData, PADDED_CHUNK_VOL, 0.0f);
+    // Thermal buffers are allocated lazily by WakeThermal(): most chunks never receive heat
     updateHeightData();
+    updateSolidRange();
 }
 
 //*********************************************************************
 Chunk::~Chunk() {
-    if (m_pVAO)
-        delete m_pVAO;
-    if (m_pVBO)
-        delete m_pVBO;
-    if (m_pIBO)
-        delete m_pIBO;
-
-    FREE_ALIGNED(m_pfCurrFrameData);
-    FREE_ALIGNED(m_pfNextFrameData);
+    releaseMeshRange();
+    releaseThermalBuffers();
 
     for (int i = 0; i < 6; i++) {
         if (m_pNeighbours[i]) {
@@ -62,61 +468,133 @@ Chunk::~Chunk() {
 }
 //*********************************************************************
 Chunk::Chunk(Chunk&& other) noexcept
-    : m_vec_fVertices(std::move(other.m_vec_fVertices)),
-      m_vec_uiIndices(std::move(other.m_vec_uiIndices)),
-      m_pVAO(other.m_pVAO),
-      m_pVBO(other.m_pVBO),
-      m_pIBO(other.m_pIBO),
+    : m_vec_uiFaces(std::move(other.m_vec_uiFaces)),
+      m_iFacesLod(other.m_iFacesLod),
+      m_bMeshDirty(other.m_bMeshDirty),
+      m_bMeshUploadRefused(other.m_bMeshUploadRefused),
+      m_pGeometryArena(other.m_pGeometryArena),
+      m_objMeshRange(other.m_objMeshRange),
+      m_uiNbUploadedFaces(other.m_uiNbUploadedFaces),
+      m_iMeshLod(other.m_iMeshLod),
+      m_iUploadedMeshLod(other.m_iUploadedMeshLod),
       m_pfCurrFrameData(other.m_pfCurrFrameData),
       m_pfNextFrameData(other.m_pfNextFrameData),
-      m_pThermalTex(std::move(other.m_pThermalTex)),
+      m_puiCurrFrameHalf(other.m_puiCurrFrameHalf),
+      m_puiNextFrameHalf(other.m_puiNextFrameHalf),
+      m_eThermalStorage(other.m_eThermalStorage),
+      m_vecCoarseCurr(std::move(other.m_vecCoarseCurr)),
+      m_vecCoarseNext(std::move(other.m_vecCoarseNext)),
+      m_iThermalLod(other.m_iThermalLod),
+      m_arrSnapshots{std::move(other.m_arrSnapshots[0]), std::move(other.m_arrSnapshots[1])},
+      m_iSnapshotFront(other.m_iSnapshotFront),
+      m_bSnapshotPending(other.m_bSnapshotPending),
+      m_bThermalUpdateInFlight(other.m_bThermalUpdateInFlight),
+      m_pThermalAtlas(other.m_pThermalAtlas),
+      m_iThermalSlot(other.m_iThermalSlot),
+      m_bThermalSlotFilled(other.m_bThermalSlotFilled),
+      m_uiSlotFillSerial(other.m_uiSlotFillSerial),
+      m_fLastMaxDelta(other.m_fLastMaxDelta),
+      m_bThermalActive(other.m_bThermalActive),
+      m_uiThermalGeneration(other.m_uiThermalGeneration),
+      m_uiUploadedGeneration(other.m_uiUploadedGeneration),
+      m_uiLodRecheckEpoch(other.m_uiLodRecheckEpoch),
       m_iChunkX(other.m_iChunkX),
-      m_iChunkZ(other.m_iChunkZ) {
-    other.m_pVAO = nullptr;
-    other.m_pVBO = nullptr;
-    other.m_pIBO = nullptr;
+      m_iChunkZ(other.m_iChunkZ),
+      m_iMinSolidY(other.m_iMinSolidY),
+      m_iMaxSolidY(other.m_iMaxSolidY) {
+    other.m_pGeometryArena = nullptr;
+    other.m_objMeshRange = {};
+    other.m_uiNbUploadedFaces = 0;
+    other.m_iUploadedMeshLod = 0;
     other.m_pfCurrFrameData = nullptr;
     other.m_pfNextFrameData = nullptr;
+    other.m_puiCurrFrameHalf = nullptr;
+    other.m_puiNextFrameHalf = nullptr;
+    other.m_iThermalLod = 0;
+    other.m_pThermalAtlas = nullptr;
+    other.m_iThermalSlot = -1;
+    other.m_bThermalSlotFilled = false;
+    other.m_bThermalActive = false;
 
     std::memcpy(m_iBlocks, other.m_iBlocks, sizeof(m_iBlocks));
     std::memcpy(m_iHeightData, other.m_iHeightData, sizeof(m_iHeightData));
+    std::memcpy(m_arrOccluderHeights, other.m_arrOccluderHeights, sizeof(m_arrOccluderHeights));
+    std::memcpy(m_arrMeshDirectionStarts,
+                other.m_arrMeshDirectionStarts,
+                sizeof(m_arrMeshDirectionStarts));
+    std::memcpy(m_arrUploadedDirectionStarts,
+                other.m_arrUploadedDirectionStarts,
+                sizeof(m_arrUploadedDirectionStarts));
 
     for (int i = 0; i < 6; ++i) m_pNeighbours[i] = other.m_pNeighbours[i];
 }
 //*********************************************************************
 Chunk& Chunk::operator=(Chunk&& other) noexcept {
     if (this != &other) {
-        m_vec_fVertices = std::move(other.m_vec_fVertices);
-        m_vec_uiIndices = std::move(other.m_vec_uiIndices);
-
-        if (m_pVAO)
-            delete m_pVAO;
-        if (m_pVBO)
-            delete m_pVBO;
-        if (m_pIBO)
-            delete m_pIBO;
-
-        m_pVAO = other.m_pVAO;
-        m_pVBO = other.m_pVBO;
-        m_pIBO = other.m_pIBO;
-
-        other.m_pVAO = nullptr;
-        other.m_pVBO = nullptr;
-        other.m_pIBO = nullptr;
-
-        FREE_ALIGNED(m_pfCurrFrameData);
-        FREE_ALIGNED(m_pfNextFrameData);
+        m_vec_uiFaces = std::move(other.m_vec_uiFaces);
+        m_bMeshDirty = other.m_bMeshDirty;
+        m_bMeshUploadRefused = other.m_bMeshUploadRefused;
+
+        std::memcpy(m_arrMeshDirectionStarts,
+                    other.m_arrMeshDirectionStarts,
+                    sizeof(m_arrMeshDirectionStarts));
+        m_iMeshLod = other.m_iMeshLod;
+        m_iFacesLod = other.m_iFacesLod;
+
+        releaseMeshRange();
+        m_pGeometryArena = other.m_pGeometryArena;
+        m_objMeshRange = other.m_objMeshRange;
+        m_uiNbUploadedFaces = other.m_uiNbUploadedFaces;
+        std::memcpy(m_arrUploadedDirectionStarts,
+                    other.m_arrUploadedDirectionStarts,
+                    sizeof(m_arrUploadedDirectionStarts));
+        m_iUploadedMeshLod = other.m_iUploadedMeshLod;
+        other.m_pGeometryArena = nullptr;
+        other.m_objMeshRange = {};
+        other.m_uiNbUploadedFaces = 0;
+        other.m_iUploadedMeshLod = 0;
+
+        releaseThermalBuffers();
 
         m_pfCurrFrameData = other.m_pfCurrFrameData;
         m_pfNextFrameData = other.m_pfNextFrameData;
+        m_puiCurrFrameHalf = other.m_puiCurrFrameHalf;
+        m_puiNextFrameHalf = other.m_puiNextFrameHalf;
+        m_eThermalStorage = other.m_eThermalStorage;
         other.m_pfCurrFrameData = nullptr;
         other.m_pfNextFrameData = nullptr;
-        m_pThermalTex = std::move(other.m_pThermalTex);
+        other.m_puiCurrFrameHalf = nullptr;
+        other.m_puiNextFrameHalf = nullptr;
+        m_vecCoarseCurr = std::move(other.m_vecCoarseCurr);
+        m_vecCoarseNext = std::move(other.m_vecCoarseNext);
+        m_iThermalLod = other.m_iThermalLod;
+        other.m_iThermalLod = 0;
+        for (int i = 0; i < 2; ++i) m_arrSnapshots[i] = std::move(other.m_arrSnapshots[i]);
+        m_iSnapshotFront = other.m_iSnapshotFront;
+        m_bSnapshotPending = other.m_bSnapshotPending;
+        m_bThermalUpdateInFlight = other.m_bThermalUpdateInFlight;
+        m_pThermalAtlas = other.m_pThermalAtlas;
+        m_iThermalSlot = other.m_iThermalSlot;
+        m_bThermalSlotFilled = other.m_bThermalSlotFilled;
+        m_uiSlotFillSerial = other.m_uiSlotFillSerial;
+        other.m_pThermalAtlas = nullptr;
+        other.m_iThermalSlot = -1;
+        other.m_bThermalSlotFilled = false;
+        m_fLastMaxDelta = other.m_fLastMaxDelta;
+        m_bThermalActive = other.m_bThermalActive;
+        m_uiThermalGeneration = other.m_uiThermalGeneration;
+        m_uiUploadedGeneration = other.m_uiUploadedGeneration;
+        m_uiLodRecheckEpoch = other.m_uiLodRecheckEpoch;
+        other.m_bThermalActive = false;
         m_iChunkX = other.m_iChunkX;
         m_iChunkZ = other.m_iChunkZ;
+        m_iMinSolidY = other.m_iMinSolidY;
+        m_iMaxSolidY = other.m_iMaxSolidY;
 
         std::memcpy(m_iBlocks, other.m_iBlocks, sizeof(m_iBlocks));
         std::memcpy(m_iHeightData, other.m_iHeightData, sizeof(m_iHeightData));
+        std::memcpy(
+            m_arrOccluderHeights, other.m_arrOccluderHeights, sizeof(m_arrOccluderHeights));
         for (int i = 0; i < 6; ++i) m_pNeighbours[i] = other.m_pNeighbours[i];
     }
     return *this;
@@ -126,22 +604,16 @@ AABB Chunk::GetAABB() const {
     float fWorldX = static_cast<float>(m_iChunkX * CHUNK_SIZE);
     float fWorldZ = static_cast<float>(m_iChunkZ * CHUNK_SIZE);
 
-    int iMinHeight = CHUNK_HEIGHT;
-    int iMaxHeight = 0;
-
-    for (int iX = 0; iX < CHUNK_SIZE; iX++) {
-        for (int iZ = 0; iZ < CHUNK_SIZE; iZ++) {
-            int iHeight = m_iHeightData[iX][iZ];
-            if (iHeight < iMinHeight)
-                iMinHeight = iHeight;
-            if (iHeight > iMaxHeight)
-                iMaxHeight = iHeight;
-        }
-    }
+    // An empty chunk collapses to a flat box at the bottom. Coarse meshes (the current one or
+    // the one being built) fill whole cells, so the layers round out to their cell size
+    const int iScale = 1 << std::max(m_iMeshLod, m_iUploadedMeshLod);
+    const int iMinHeight = m_iMinSolidY <= m_iMaxSolidY ? m_iMinSolidY / iScale * iScale : 0;
+    const int iMaxHeight =
+        m_iMinSolidY <= m_iMaxSolidY ? (m_iMaxSolidY / iScale + 1) * iScale : 0;
 
     return AABB(
         Core::Vec3(fWorldX, static_cast<float>(iMinHeight), fWorldZ),
-        Core::Vec3(fWorldX + CHUNK_SIZE, static_cast<float>(iMaxHeight + 1), fWorldZ + CHUNK_SIZE));
+        Core::Vec3(fWorldX + CHUNK_SIZE, static_cast<float>(iMaxHeight), fWorldZ + CHUNK_SIZE));
 }
 
 //*********************************************************************
@@ -149,9 +621,60 @@ void Chunk::SetBlockAt(int iX, int iY, int iZ, uint8_t uiBlockType) {
     int iIndex = GetFlatIndexOf3DLayer(iX, iY, iZ);
     if (iIndex != -1) {
         m_iBlocks[iIndex] = uiBlockType;
+        // Placing only widens the range; removing from a boundary layer needs a rescan
+        if (uiBlockType != AIR) {
+            m_iMinSolidY = std::min(m_iMinSolidY, iY);
+            m_iMaxSolidY = std::max(m_iMaxSolidY, iY);
+        } else if (iY == m_iMinSolidY || iY == m_iMaxSolidY) {
+            updateSolidRange();
+        }
+        updateOccluderCell(iX / OCCLUDER_CELL_SIZE, iZ / OCCLUDER_CELL_SIZE);
     }
 }
 
+//*********************************************************************
+void Chunk::updateSolidRange() {
+    auto IsLayerSolid = [this](int iY) {
+        const uint8_t* puiLayer = m_iBlocks + iY * CHUNK_SIZE;
+        for (int iZ = 0; iZ < CHUNK_SIZE; ++iZ, puiLayer += CHUNK_SIZE * CHUNK_HEIGHT)
+            for (int iX = 0; iX < CHUNK_SIZE; ++iX)
+                if (puiLayer[iX] != AIR)
+                    return true;
+        return false;
+    };
+    m_iMinSolidY = CHUNK_HEIGHT;
+    m_iMaxSolidY = -1;
+    for (int iY = 0; iY < CHUNK_HEIGHT; ++iY) {
+        if (IsLayerSolid(iY)) {
+            m_iMinSolidY = iY;
+            break;
+        }
+    }
+    for (int iY = CHUNK_HEIGHT - 1; iY >= m_iMinSolidY; --iY) {
+        if (IsLayerSolid(iY)) {
+            m_iMaxSolidY = iY;
+            break;
+        }
+    }
+    for (int iCellX = 0; iCellX < OCCLUDER_CELLS; ++iCellX)
+        for (int iCellZ = 0; iCellZ < OCCLUDER_CELLS; ++iCellZ) updateOccluderCell(iCellX, iCellZ);
+}
+
+//*********************************************************************
+void Chunk::updateOccluderCell(int iCellX, int iCellZ) {
+    // Lowest solid-from-the-ground column of the cell: the box below it holds no air
+    int iHeight = CHUNK_HEIGHT;
+    for (int iX = iCellX * OCCLUDER_CELL_SIZE; iX < (iCellX + 1) * OCCLUDER_CELL_SIZE; ++iX) {
+        for (int iZ = iCellZ * OCCLUDER_CELL_SIZE; iZ < (iCellZ + 1) * OCCLUDER_CELL_SIZE; ++iZ) {
+            const uint8_t* puiColumn = m_iBlocks + iX + iZ * CHUNK_SIZE * CHUNK_HEIGHT;
+            int iY = 0;
+            while (iY < iHeight && puiColumn[iY * CHUNK_SIZE] != AIR) ++iY;
+            iHeight = iY;
+        }
+    }
+    m_arrOccluderHeights[iCellX][iCellZ] = static_cast<uint8_t>(iHeight);
+}
+
 //*********************************************************************
 void Chunk::updateHeightData() {
     noise.SetNoiseType(FastNoiseLite::NoiseType_OpenSimplex2);
@@ -186,354 +709,951 @@ void Chunk::updateHeightData() {
 }
 
 //*********************************************************************
-void Chunk::updateBuffers() {
-    if (m_pVBO) {
-        delete m_pVBO;
-        m_pVBO = nullptr;
-    }
-    if (m_pIBO) {
-        delete m_pIBO;
-        m_pIBO = nullptr;
-    }
-
-    if (!m_vec_fVertices.empty()) {
-        m_uiVertexCount = m_vec_fVertices.size() / 5;
-        m_pVBO = new Renderer::VertexBuffer(
-            m_vec_fVertices.data(),
-            static_cast<unsigned int>(m_vec_fVertices.size()) * sizeof(float));
+bool Chunk::updateBuffers(Renderer::GeometryArena& objArena) {
+    static_assert(sizeof(ChunkFace) == 4, "The geometry arena holds one face per word");
+    const auto uiNbFaces = static_cast<unsigned int>(m_vec_uiFaces.size());
+
+    // An empty mesh holds no range and is not drawn (WorldRenderer skips chunks without faces)
+    if (uiNbFaces == 0) {
+        releaseMeshRange();
+        m_iUploadedMeshLod = m_iFacesLod;
+        return true;
     }
 
-    if (!m_vec_uiIndices.empty()) {
-        m_uiTriangleCount = m_vec_uiIndices.size() / 3;
-        m_pIBO = new Renderer::IndexBuffer(m_vec_uiIndices.data(),
-                                           static_cast<unsigned int>(m_vec_uiIndices.size()));
-    }
-
-    if (m_pVBO) {
-        // Attribute 0: Pos (3 floats)
-        m_pVAO->LinkAttribute(*m_pVBO, 0, 3, 5, 0);
-        // Attribute 1: TexCoord (2 floats)
-        m_pVAO->LinkAttribute(*m_pVBO, 1, 2, 5, 3);
-        if (m_pIBO) {
-            m_pVAO->AttachIndexBuffer(*m_pIBO);
-        }
+    // Rewrite the existing range in place when the mesh fits. A range outgrown once is
+    // reallocated with a quarter of headroom: a chunk that grows is usually being edited
+    if (m_pGeometryArena != &objArena || uiNbFaces > m_objMeshRange.m_uiSize) {
+        const bool bRegrow = m_pGeometryArena == &objArena;
+        releaseMeshRange();
+        Renderer::GeometryArena::Range objRange;
+        if (!objArena.Allocate(bRegrow ? uiNbFaces + uiNbFaces / 4 : uiNbFaces, objRange))
+            return false;  // Arena at its size limit (counted by the arena)
+        m_pGeometryArena = &objArena;
+        m_objMeshRange = objRange;
     }
+    objArena.Write(m_objMeshRange, m_vec_uiFaces.data(), uiNbFaces);
+    m_uiNbUploadedFaces = uiNbFaces;
+    std::memcpy(m_arrUploadedDirectionStarts,
+                m_arrMeshDirectionStarts,
+                sizeof(m_arrUploadedDirectionStarts));
+    m_iUploadedMeshLod = m_iFacesLod;
+    m_uiVertexCount = m_vec_uiFaces.size() * 4;
+    m_uiTriangleCount = m_vec_uiFaces.size() * 2;
+    m_uiMeshBytes = m_vec_uiFaces.size() * sizeof(ChunkFace);
+    return true;
 }
 
 //*********************************************************************
-void Chunk::ReconstructMesh(bool bEnableNeighborCulling) {
-    m_vec_fVertices.clear();
-    m_vec_uiIndices.clear();
-    for (int iX = 0; iX < CHUNK_SIZE; iX++) {
-        for (int iZ = 0; iZ < CHUNK_SIZE; iZ++) {
-            for (int iY = 0; iY < CHUNK_HEIGHT; iY++) {
-                int iIndex = GetFlatIndexOf3DLayer(iX, iY, iZ);
-                if (iIndex == -1)
-                    continue;
-
-                uint8_t iBlockType = m_iBlocks[iIndex];
-                if (iBlockType == AIR)
-                    continue;
-
-                // UP (Y+)
-                if (!bEnableNeighborCulling ||
-                    (iY == CHUNK_HEIGHT - 1 || GetBlockAt(iX, iY + 1, iZ) == 0))
-                    addBlockFace(iX, iY, iZ, FaceDirection::UP, iBlockType);
-
-                // DOWN (Y-)
-                if (!bEnableNeighborCulling || (iY == 0 || GetBlockAt(iX, iY - 1, iZ) == 0))
-                    addBlockFace(iX, iY, iZ, FaceDirection::DOWN, iBlockType);
-
-                // RIGHT (X+)
-                if (!bEnableNeighborCulling || GetBlockAt(iX + 1, iY, iZ) == 0)
-                    addBlockFace(iX, iY, iZ, FaceDirection::RIGHT, iBlockType);
-
-                // LEFT (X-)
-                if (!bEnableNeighborCulling || GetBlockAt(iX - 1, iY, iZ) == 0)
-                    addBlockFace(iX, iY, iZ, FaceDirection::LEFT, iBlockType);
+void Chunk::releaseMeshRange() {
+    if (m_pGeometryArena)
+        m_pGeometryArena->Free(m_objMeshRange);
+    m_pGeometryArena = nullptr;
+    m_objMeshRange = {};
+    m_uiNbUploadedFaces = 0;
+    std::memset(m_arrUploadedDirectionStarts, 0, sizeof(m_arrUploadedDirectionStarts));
+    m_iUploadedMeshLod = 0;
+    m_uiVertexCount = 0;
+    m_uiTriangleCount = 0;
+    m_uiMeshBytes = 0;
+}
 
-                // FRONT (Z+)
-                if (!bEnableNeighborCulling || GetBlockAt(iX, iY, iZ + 1) == 0)
-                    addBlockFace(iX, iY, iZ, FaceDirection::FRONT, iBlockType);
+//*********************************************************************
+void Chunk::ReconstructMesh(bool bEnableNeighborCulling, MeshingMode eMode) {
+    ChunkMeshInput objInput;
+    TakeMeshInput(objInput);
+
+    // Build into the current buffers to keep their capacity
+    ChunkMesh objMesh;
+    objMesh.m_vecFaces.swap(m_vec_uiFaces);
+    BuildMesh(objInput, bEnableNeighborCulling, eMode, objMesh);
+    SetMesh(std::move(objMesh));
+}
 
-                // BACK (Z-)
-                if (!bEnableNeighborCulling || GetBlockAt(iX, iY, iZ - 1) == 0)
-                    addBlockFace(iX, iY, iZ, FaceDirection::BACK, iBlockType);
+//*********************************************************************
+void Chunk::TakeMeshInput(ChunkMeshInput& objInput) const {
+    std::memcpy(objInput.m_arrBlocks, m_iBlocks, sizeof(objInput.m_arrBlocks));
+    std::memset(objInput.m_arrBorders, 0, sizeof(objInput.m_arrBorders));
+    objInput.m_iLod = m_iMeshLod;
+    const MeshGrid objGrid = getMeshGrid(m_iMeshLod);
+    const int* arrDims = objGrid.m_arrDims;
+    for (int iDir = Direction::NORTH; iDir <= Direction::BELOW; ++iDir) {
+        const Chunk* pNeighbour = m_pNeighbours[iDir];
+        // Cells of another level do not line up: the border stays air, so both chunks close the
+        // seam with their own boundary faces (skirts)
+        if (!pNeighbour || pNeighbour->m_iMeshLod != m_iMeshLod)
+            continue;
+        // The neighbour's layer touching this chunk: its first cells on a positive face
+        const int iAxis = getNormalAxis(FACE_NORMALS[iDir]);
+        const int iAxisP = (iAxis + 1) % 3;
+        const int iAxisQ = (iAxis + 2) % 3;
+        int arrCell[3];
+        arrCell[iAxis] = FACE_NORMALS[iDir][iAxis] > 0 ? 0 : arrDims[iAxis] - 1;
+        for (arrCell[iAxisP] = 0; arrCell[iAxisP] < arrDims[iAxisP]; ++arrCell[iAxisP]) {
+            uint32_t& uiRow = objInput.m_arrBorders[iDir][arrCell[iAxisP]];
+            for (arrCell[iAxisQ] = 0; arrCell[iAxisQ] < arrDims[iAxisQ]; ++arrCell[iAxisQ]) {
+                if (getCellBlock(pNeighbour->m_iBlocks, objGrid, arrCell) != AIR)
+                    uiRow |= 1u << arrCell[iAxisQ];
             }
         }
     }
 }
 
 //*********************************************************************
-void Chunk::addBlockFace(int iX, int iY, int iZ, FaceDirection iDir, int iBlockType) {
-    unsigned int iStartIndex = static_cast<unsigned int>(m_vec_fVertices.size()) / 5;
-
-    float fX = static_cast<float>(iX) + (CHUNK_SIZE * static_cast<float>(m_iChunkX));
-    float fY = static_cast<float>(iY);
-    float fZ = static_cast<float>(iZ) + (CHUNK_SIZE * static_cast<float>(m_iChunkZ));
-
-    // Texture Atlas Calculations
-    int iAtlasCol = 0, iAtlasRow = 0;
-
-    // Simple Texture Mapper
-    if (iBlockType == GRASS) {
-        if (iDir == FaceDirection::UP) {
-            iAtlasCol = 2;
-            iAtlasRow = 9;
-        }  // Grass Top
-        else if (iDir == FaceDirection::DOWN) {
-            iAtlasCol = 1;
-            iAtlasRow = 0;
-        }  // Stone
-        else {
-            iAtlasCol = 3;
-            iAtlasRow = 0;
-        }  // Grass Side
-    } else if (iBlockType == DIRT) {
-        iAtlasCol = 2;
-        iAtlasRow = 0;  // Dirt
-    } else if (iBlockType == STONE) {
-        iAtlasCol = 1;
-        iAtlasRow = 0;  // Stone
+void Chunk::BuildMesh(const ChunkMeshInput& objInput,
+                      bool bEnableNeighborCulling,
+                      MeshingMode eMode,
+                      ChunkMesh& objMesh) {
+    MeshScratch& objScratch = getMeshScratch();
+    const FacePlanes& objPlanes = objScratch.m_objPlanes;
+    const MeshGrid objGrid = getMeshGrid(objInput.m_iLod);
+
+    // Mesh LOD: the same meshers over the downsampled cells (borders are already per cell)
+    const ChunkMeshInput* pCells = &objInput;
+    if (objGrid.m_iScale > 1) {
+        ChunkMeshInput& objCoarse = objScratch.m_objCoarseInput;
+        int arrCell[3];
+        for (arrCell[2] = 0; arrCell[2] < objGrid.m_arrDims[2]; ++arrCell[2])
+            for (arrCell[1] = 0; arrCell[1] < objGrid.m_arrDims[1]; ++arrCell[1])
+                for (arrCell[0] = 0; arrCell[0] < objGrid.m_arrDims[0]; ++arrCell[0])
+                    objCoarse.m_arrBlocks[getBlockIndex(arrCell)] =
+                        getCellBlock(objInput.m_arrBlocks, objGrid, arrCell);
+        std::memcpy(objCoarse.m_arrBorders, objInput.m_arrBorders, sizeof(objCoarse.m_arrBorders));
+        objCoarse.m_iLod = objInput.m_iLod;
+        pCells = &objCoarse;
     }
-
-    float fSlotSize = 1.0f / 16.0f;
-    float u0 = static_cast<float>(iAtlasCol) * fSlotSize;
-    float v1 = static_cast<float>(iAtlasRow) * fSlotSize;
-    float u1 = u0 + fSlotSize;
-    float v0 = v1 + fSlotSize;
-
-    // Face Geometry
-    // Format: X, Y, Z, U, V
-    switch (iDir) {
-        case FaceDirection::FRONT:  // Z+
-            m_vec_fVertices.insert(
-                m_vec_fVertices.end(),
-                {
-                    fX,     fY,     fZ + 1, u0, v0, fX + 1, fY,     fZ + 1, u1, v0,
-                    fX + 1, fY + 1, fZ + 1, u1, v1, fX,     fY + 1, fZ + 1, u0, v1,
-                });
-            break;
-
-        case FaceDirection::BACK:  // Z-
-            m_vec_fVertices.insert(m_vec_fVertices.end(),
-                                   {
-                                       fX,     fY,     fZ, u0, v0, fX,     fY + 1, fZ, u0, v1,
-                                       fX + 1, fY + 1, fZ, u1, v1, fX + 1, fY,     fZ, u1, v0,
-                                   });
-            break;
-
-        case FaceDirection::RIGHT:  // X+
-            m_vec_fVertices.insert(
-                m_vec_fVertices.end(),
-                {
-                    fX + 1, fY,     fZ,     u0, v0, fX + 1, fY + 1, fZ,     u0, v1,
-                    fX + 1, fY + 1, fZ + 1, u1, v1, fX + 1, fY,     fZ + 1, u1, v0,
-                });
-            break;
-
-        case FaceDirection::LEFT:  // X-
-            m_vec_fVertices.insert(m_vec_fVertices.end(),
-                                   {
-                                       fX, fY,     fZ,     u0, v0, fX, fY,     fZ + 1, u1, v0,
-                                       fX, fY + 1, fZ + 1, u1, v1, fX, fY + 1, fZ,     u0, v1,
-                                   });
-            break;
-
-        case FaceDirection::UP:  // Y+
-            m_vec_fVertices.insert(
-                m_vec_fVertices.end(),
-                {
-                    fX,     fY + 1, fZ,     u0, v1, fX,     fY + 1, fZ + 1, u0, v0,
-                    fX + 1, fY + 1, fZ + 1, u1, v0, fX + 1, fY + 1, fZ,     u1, v1,
-                });
-            break;
-
-        case FaceDirection::DOWN:  // Y-
-            m_vec_fVertices.insert(m_vec_fVertices.end(),
-                                   {
-                                       fX,     fY, fZ,     u0, v1, fX + 1, fY, fZ,     u1, v1,
-                                       fX + 1, fY, fZ + 1, u1, v0, fX,     fY, fZ + 1, u0, v0,
-                                   });
-            break;
+    buildFacePlanes(*pCells, objGrid, bEnableNeighborCulling, objScratch.m_objPlanes);
+
+    // Pass 1: count the visible faces, an upper bound on the quads (greedy merges them)
+    size_t iNbFaces = 0;
+    for (const auto& arrSlices : objPlanes.m_arrRows)
+        for (const auto& arrRows : arrSlices)
+            for (uint32_t uiRow : arrRows) iNbFaces += static_cast<size_t>(std::popcount(uiRow));
+    objScratch.Reserve(iNbFaces);
+
+    // Pass 2: fill the scratch arrays in place, one direction after the other
+    for (int iDir = FaceDirection::FRONT; iDir <= FaceDirection::DOWN; ++iDir) {
+        objMesh.m_arrDirectionStarts[iDir] = static_cast<unsigned int>(objScratch.m_iNbQuads);
+        const auto eDir = static_cast<FaceDirection>(iDir);
+        if (eMode == MeshingMode::GREEDY)
+            emitGreedyFaces(*pCells, objGrid, eDir, objPlanes, objScratch);
+        else
+            emitFaces(*pCells, objGrid, eDir, objPlanes, objScratch);
     }
+    objMesh.m_arrDirectionStarts[6] = static_cast<unsigned int>(objScratch.m_iNbQuads);
 
-    // Indices (Quad -> 2 Triangles)
-    m_vec_uiIndices.push_back(iStartIndex + 0);
-    m_vec_uiIndices.push_back(iStartIndex + 1);
-    m_vec_uiIndices.push_back(iStartIndex + 2);
-    m_vec_uiIndices.push_back(iStartIndex + 2);
-    m_vec_uiIndices.push_back(iStartIndex + 3);
-    m_vec_uiIndices.push_back(iStartIndex + 0);
+    // Exact-size copy out: no allocation once objMesh has held a mesh this large
+    const auto itrFaces = objScratch.m_vecFaces.begin();
+    const auto iNbQuads = static_cast<std::ptrdiff_t>(objScratch.m_iNbQuads);
+    objMesh.m_vecFaces.assign(itrFaces, itrFaces + iNbQuads);
+    objMesh.m_iLod = objInput.m_iLod;
 }
 
 //*********************************************************************
-void Chunk::UploadMesh() {
-    if (!m_pVAO) {
-        m_pVAO = new Renderer::VertexArray();
-    }
-    updateBuffers();
-
-    // Clear CPU buffers after upload to save RAM
-    m_vec_fVertices.clear();
-    m_vec_uiIndices.clear();
+void Chunk::SetMesh(ChunkMesh&& objMesh) {
+    m_vec_uiFaces = std::move(objMesh.m_vecFaces);
+    std::memcpy(m_arrMeshDirectionStarts,
+                objMesh.m_arrDirectionStarts,
+                sizeof(m_arrMeshDirectionStarts));
+    m_iFacesLod = objMesh.m_iLod;
 }
+
 //*********************************************************************
-void Chunk::Render() const {
-    if (m_pVAO && m_pVBO && m_pIBO) {
-        m_pVAO->Bind();
-        glDrawElements(GL_TRIANGLES, m_pIBO->GetCount(), GL_UNSIGNED_INT, 0);
-        m_pVAO->Unbind();
-    }
+bool Chunk::UploadMesh(Renderer::GeometryArena& objArena) {
+    // Refused: the old range is gone already, the mesh waits here for a retry
+    m_bMeshUploadRefused = !updateBuffers(objArena);
+    if (m_bMeshUploadRefused)
+        return false;
+
+    // The GPU holds the mesh now; the emptied vector keeps its capacity for the next remesh
+    m_vec_uiFaces.clear();
+    return true;
 }
 //*********************************************************************
 float Chunk::GetTemperatureAt(int iX, int iY, int iZ) const {
     if (iX >= 0 && iX < CHUNK_SIZE && iY >= 0 && iY < CHUNK_HEIGHT && iZ >= 0 && iZ < CHUNK_SIZE) {
-        return m_pfCurrFrameData[GetPaddedIndexOf3DLayer(iX, iY, iZ)];
+        // A chunk without buffers has never been heated
+        return HasThermalData() ? loadCell(GetPaddedIndexOf3DLayer(iX, iY, iZ)) : 0.0f;
     }
     // Boundary checks (Neighbor querying)
     if (iX < 0) {
         if (m_pNeighbours[Direction::WEST])
             return m_pNeighbours[Direction::WEST]->GetTemperatureAt(CHUNK_SIZE - 1, iY, iZ);
-        else if (m_bVonNeumannBC)
-            return m_pfCurrFrameData[GetPaddedIndexOf3DLayer(0, iY, iZ)];
+        else if (m_bVonNeumannBC && HasThermalData())
+            return loadCell(GetPaddedIndexOf3DLayer(0, iY, iZ));
     } else if (iX >= CHUNK_SIZE) {
         if (m_pNeighbours[Direction::EAST])
             return m_pNeighbours[Direction::EAST]->GetTemperatureAt(0, iY, iZ);
-        else if (m_bVonNeumannBC)
-            return m_pfCurrFrameData[GetPaddedIndexOf3DLayer(CHUNK_SIZE - 1, iY, iZ)];
+        else if (m_bVonNeumannBC && HasThermalData())
+            return loadCell(GetPaddedIndexOf3DLayer(CHUNK_SIZE - 1, iY, iZ));
     }
 
     if (iY < 0) {
         if (m_pNeighbours[Direction::BELOW])
             return m_pNeighbours[Direction::BELOW]->GetTemperatureAt(iX, CHUNK_HEIGHT - 1, iZ);
-        else if (m_bVonNeumannBC)
-            return m_pfCurrFrameData[GetPaddedIndexOf3DLayer(iX, 0, iZ)];
+        else if (m_bVonNeumannBC && HasThermalData())
+            return loadCell(GetPaddedIndexOf3DLayer(iX, 0, iZ));
     } else if (iY >= CHUNK_HEIGHT) {
         if (m_pNeighbours[Direction::ABOVE])
             return m_pNeighbours[Direction::ABOVE]->GetTemperatureAt(iX, 0, iZ);
-        else if (m_bVonNeumannBC)
-            return m_pfCurrFrameData[GetPaddedIndexOf3DLayer(iX, CHUNK_SIZE - 1, iZ)];
+        else if (m_bVonNeumannBC && HasThermalData())
+            return loadCell(GetPaddedIndexOf3DLayer(iX, CHUNK_SIZE - 1, iZ));
     }
 
     if (iZ < 0) {
         if (m_pNeighbours[Direction::SOUTH])
             return m_pNeighbours[Direction::SOUTH]->GetTemperatureAt(iX, iY, CHUNK_SIZE - 1);
-        else if (m_bVonNeumannBC)
-            return m_pfCurrFrameData[GetPaddedIndexOf3DLayer(iX, iY, 0)];
+        else if (m_bVonNeumannBC && HasThermalData())
+            return loadCell(GetPaddedIndexOf3DLayer(iX, iY, 0));
     } else if (iZ >= CHUNK_SIZE) {
         if (m_pNeighbours[Direction::NORTH])
             return m_pNeighbours[Direction::NORTH]->GetTemperatureAt(iX, iY, 0);
-        else if (m_bVonNeumannBC)
-            return m_pfCurrFrameData[GetPaddedIndexOf3DLayer(iX, iY, CHUNK_SIZE - 1)];
+        else if (m_bVonNeumannBC && HasThermalData())
+            return loadCell(GetPaddedIndexOf3DLayer(iX, iY, CHUNK_SIZE - 1));
     }
 
     return 0.0f;
 }
 //*********************************************************************
-void Chunk::ThermalStep(float fThermalDiffusivity, float fDeltaTime) {
-    float fCoefficient = fThermalDiffusivity * fDeltaTime;
+template <typename T>
+void Chunk::fillHalo() {
+    T* pCurr = getCurrField<T>();
 
-    for (int iZ = 0; iZ < CHUNK_SIZE; ++iZ) {
-        for (int iY = 0; iY < CHUNK_HEIGHT; ++iY) {
-            for (int iX = 0; iX < CHUNK_SIZE; ++iX) {
-                int iPaddedIndex = GetPaddedIndexOf3DLayer(iX, iY, iZ);
-                float fCurrentTemp = m_pfCurrFrameData[iPaddedIndex];
-                float fNeighborSum =
-                    GetTemperatureAt(iX + 1, iY, iZ) + GetTemperatureAt(iX - 1, iY, iZ) +
-                    GetTemperatureAt(iX, iY + 1, iZ) + GetTemperatureAt(iX, iY - 1, iZ) +
-                    GetTemperatureAt(iX, iY, iZ + 1) + GetTemperatureAt(iX, iY, iZ - 1);
-                m_pfNextFrameData[iPaddedIndex] =
-                    fCurrentTemp + fCoefficient * (fNeighborSum - 6.0f * fCurrentTemp);
-            }
-        }
-    }
-}
-//*********************************************************************
-void Chunk::ThermalStep_AVX2(float fThermalDiffusivity, float fDeltaTime) {
-    float fCoefficient = fThermalDiffusivity * fDeltaTime;
     const int iOffsetY = PADDED_CHUNK_SIZE;
     const int iOffsetZ = PADDED_CHUNK_SIZE * PADDED_CHUNK_HEIGHT;
 
-    __m256 vecCoeff = _mm256_set1_ps(fCoefficient);
-    __m256 vecSix = _mm256_set1_ps(6.0f);
-
-    // Phase 1 : The Core (Pure AVX2 SIMD Speed)
+    // Resolves the source buffer for one face: the neighbour's data, our own data (mirror) or none.
+    // A linked neighbour that is still cold has no buffers yet and is at 0 K; only a missing
+    // neighbour mirrors.
+    auto HasNeighbourData = [&](Direction iDir) {
+        return m_pNeighbours[iDir] && m_pNeighbours[iDir]->getCurrField<T>();
+    };
+    auto GetFaceSource = [&](Direction iDir) -> const T* {
+        if (m_pNeighbours[iDir])
+            return m_pNeighbours[iDir]->getCurrField<T>();
+        return m_bVonNeumannBC ? pCurr : nullptr;
+    };
+
+    // X faces (strided along X, one value per row)
+    const T* pWest = GetFaceSource(Direction::WEST);
+    const T* pEast = GetFaceSource(Direction::EAST);
+    int iWestSrcX = HasNeighbourData(Direction::WEST) ? CHUNK_SIZE - 1 : 0;
+    int iEastSrcX = HasNeighbourData(Direction::EAST) ? 0 : CHUNK_SIZE - 1;
     for (int iZ = 0; iZ < CHUNK_SIZE; ++iZ) {
         for (int iY = 0; iY < CHUNK_HEIGHT; ++iY) {
-            int iX = 0;
-            int iIndex = (iX + 1) + (iY + 1) * iOffsetY + (iZ + 1) * iOffsetZ;
-
-            for (; iX < CHUNK_SIZE - 8; iX += 8, iIndex += 8) {
-                __m256 curr = _mm256_loadu_ps(&m_pfCurrFrameData[iIndex]);
-
-                __m256 x1 = _mm256_loadu_ps(&m_pfCurrFrameData[iIndex - 1]);
-                __m256 x2 = _mm256_loadu_ps(&m_pfCurrFrameData[iIndex + 1]);
-                __m256 y1 = _mm256_loadu_ps(&m_pfCurrFrameData[iIndex - iOffsetY]);
-                __m256 y2 = _mm256_loadu_ps(&m_pfCurrFrameData[iIndex + iOffsetY]);
-                __m256 z1 = _mm256_loadu_ps(&m_pfCurrFrameData[iIndex - iOffsetZ]);
-                __m256 z2 = _mm256_loadu_ps(&m_pfCurrFrameData[iIndex + iOffsetZ]);
+            int iRow = (iY + 1) * iOffsetY + (iZ + 1) * iOffsetZ;
+            pCurr[iRow] = pWest ? pWest[iRow + iWestSrcX + 1] : T{};
+            pCurr[iRow + CHUNK_SIZE + 1] = pEast ? pEast[iRow + iEastSrcX + 1] : T{};
+        }
+    }
 
-                __m256 neighborSum =
-                    _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(x1, x2), _mm256_add_ps(y1, y2)),
-                                  _mm256_add_ps(z1, z2));
+    // Y and Z faces (contiguous rows along X)
+    // (Values are copied bit for bit, so the same code serves FP32 and FP16 fields)
+    auto CopyRow = [](T* pDst, const T* pSrc) {
+        if (pSrc)
+            std::memcpy(pDst, pSrc, CHUNK_SIZE * sizeof(T));
+        else
+            std::fill_n(pDst, CHUNK_SIZE, T{});
+    };
+
+    const T* pBelow = GetFaceSource(Direction::BELOW);
+    const T* pAbove = GetFaceSource(Direction::ABOVE);
+    int iBelowSrcY = HasNeighbourData(Direction::BELOW) ? CHUNK_HEIGHT - 1 : 0;
+    int iAboveSrcY = HasNeighbourData(Direction::ABOVE) ? 0 : CHUNK_HEIGHT - 1;
+    for (int iZ = 0; iZ < CHUNK_SIZE; ++iZ) {
+        CopyRow(&pCurr[GetPaddedIndexOf3DLayer(0, -1, iZ)],
+                pBelow ? &pBelow[GetPaddedIndexOf3DLayer(0, iBelowSrcY, iZ)] : nullptr);
+        CopyRow(&pCurr[GetPaddedIndexOf3DLayer(0, CHUNK_HEIGHT, iZ)],
+                pAbove ? &pAbove[GetPaddedIndexOf3DLayer(0, iAboveSrcY, iZ)] : nullptr);
+    }
 
-                __m256 next = _mm256_fmadd_ps(
-                    vecCoeff, _mm256_sub_ps(neighborSum, _mm256_mul_ps(vecSix, curr)), curr);
+    const T* pSouth = GetFaceSource(Direction::SOUTH);
+    const T* pNorth = GetFaceSource(Direction::NORTH);
+    int iSouthSrcZ = HasNeighbourData(Direction::SOUTH) ? CHUNK_SIZE - 1 : 0;
+    int iNorthSrcZ = HasNeighbourData(Direction::NORTH) ? 0 : CHUNK_SIZE - 1;
+    for (int iY = 0; iY < CHUNK_HEIGHT; ++iY) {
+        CopyRow(&pCurr[GetPaddedIndexOf3DLayer(0, iY, -1)],
+                pSouth ? &pSouth[GetPaddedIndexOf3DLayer(0, iY, iSouthSrcZ)] : nullptr);
+        CopyRow(&pCurr[GetPaddedIndexOf3DLayer(0, iY, CHUNK_SIZE)],
+                pNorth ? &pNorth[GetPaddedIndexOf3DLayer(0, iY, iNorthSrcZ)] : nullptr);
+    }
+}
+//*********************************************************************
+void Chunk::FillHalo() {
+    if (m_iThermalLod > 0) {
+        fillCoarseHalo();
+        return;
+    }
+    if (m_pfCurrFrameData)
+        fillHalo<float>();
+    else if (m_puiCurrFrameHalf)
+        fillHalo<HalfFloat>();
+    else
+        return;
+    fillLodInterfaceHalo();
+}
+//*********************************************************************
+StencilRange Chunk::GetInteriorStencilRange() {
+    StencilRange objRange;
+    objRange.m_iStrideY = PADDED_CHUNK_SIZE;
+    objRange.m_iStrideZ = PADDED_CHUNK_SIZE * PADDED_CHUNK_HEIGHT;
+    objRange.m_iBeginX = 1;
+    objRange.m_iEndX = CHUNK_SIZE + 1;
+    objRange.m_iBeginY = 1;
+    objRange.m_iEndY = CHUNK_HEIGHT + 1;
+    objRange.m_iBeginZ = 1;
+    objRange.m_iEndZ = CHUNK_SIZE + 1;
+    return objRange;
+}
+//*********************************************************************
+void Chunk::ThermalStep(float fThermalDiffusivity, float fDeltaTime) {
+    if (m_iThermalLod > 0) {
+        stepCoarse(fThermalDiffusivity * fDeltaTime, false);
+        return;
+    }
+    if (m_puiCurrFrameHalf) {
+        m_fLastMaxDelta = ThermalKernels::StencilSweep_F16(m_puiCurrFrameHalf,
+                                                           m_puiNextFrameHalf,
+                                                           GetInteriorStencilRange(),
+                                                           fThermalDiffusivity * fDeltaTime);
+        return;
+    }
+    if (!m_pfCurrFrameData)
+        return;
+    m_fLastMaxDelta = ThermalKernels::StencilSweep(m_pfCurrFrameData,
+                                                   m_pfNextFrameData,
+                                                   GetInteriorStencilRange(),
+                                                   fThermalDiffusivity * fDeltaTime);
+}
+//*********************************************************************
+void Chunk::ThermalStep_SIMD(float fThermalDiffusivity, float fDeltaTime) {
+    if (m_iThermalLod > 0) {
+        stepCoarse(fThermalDiffusivity * fDeltaTime, true);
+        return;
+    }
+    if (m_puiCurrFrameHalf) {
+        m_fLastMaxDelta = ThermalKernels::StencilSweep_F16_SIMD(m_puiCurrFrameHalf,
+                                                                m_puiNextFrameHalf,
+                                                                GetInteriorStencilRange(),
+                                                                fThermalDiffusivity * fDeltaTime);
+        return;
+    }
+    if (!m_pfCurrFrameData)
+        return;
+    // The halo ring holds the neighbour faces, so every cell uses the same branch-free stencil
+    m_fLastMaxDelta = ThermalKernels::StencilSweep_SIMD(m_pfCurrFrameData,
+                                                        m_pfNextFrameData,
+                                                        GetInteriorStencilRange(),
+                                                        fThermalDiffusivity * fDeltaTime);
+}
+//*********************************************************************
+template <typename T>
+void Chunk::gatherTile(float* pfTile,
+                       uint8_t* puiPinned,
+                       int iGhost,
+                       int iTileX,
+                       int iTileY,
+                       int iTileZ) const {
+    // Interior plus a ghost zone of width iGhost resolved through the neighbour graph.
+    // Each row resolves Z, then Y, then splits X into west/own/east segments, so diagonal cells
+    // come from the neighbour's neighbour. Same boundary rule as fillHalo(): a linked but cold
+    // neighbour is at 0 K, a missing one mirrors (even extension) under the Von Neumann condition
+    // and is at 0 K otherwise. Zero segments are flagged in puiPinned (one entry per tile row), as
+    // they must stay at 0 K for every one of the blocked steps.
+    // Hop() returns false when the coordinate leaves through a missing Dirichlet face.
+    auto Hop = [this](const Chunk*& pChunk,
+                      int& iCoord,
+                      int iSize,
+                      Direction iNeg,
+                      Direction iPos) {
+        if (iCoord >= 0 && iCoord < iSize)
+            return true;
+        const bool bNeg = iCoord < 0;
+        if (const Chunk* pNext = pChunk->m_pNeighbours[bNeg ? iNeg : iPos]) {
+            pChunk = pNext;  // Cold chunks are walked through, so hot diagonals stay reachable
+            iCoord += bNeg ? iSize : -iSize;
+            return true;
+        }
+        if (!m_bVonNeumannBC)
+            return false;
+        iCoord = bNeg ? -1 - iCoord : 2 * iSize - 1 - iCoord;
+        return true;
+    };
+    auto GetRow = [](const Chunk* pChunk, int iSrcRow) -> const T* {
+        return (pChunk && pChunk->getCurrField<T>()) ? &pChunk->getCurrField<T>()[iSrcRow]
+                                                     : nullptr;
+    };
+
+    for (int iTZ = 0; iTZ < iTileZ; ++iTZ) {
+        for (int iTY = 0; iTY < iTileY; ++iTY) {
+            const int iTileRow = iTY + iTZ * iTileY;
+            float* pfTileRow = &pfTile[iTileRow * iTileX];
+            uint8_t& uiPinned = puiPinned[iTileRow];
+            const Chunk* pRowChunk = this;
+            int iSrcZ = iTZ - iGhost;
+            int iSrcY = iTY - iGhost;
+            if (!Hop(pRowChunk, iSrcZ, CHUNK_SIZE, Direction::SOUTH, Direction::NORTH) ||
+                !Hop(pRowChunk, iSrcY, CHUNK_HEIGHT, Direction::BELOW, Direction::ABOVE)) {
+                std::fill_n(pfTileRow, iTileX, 0.0f);
+                uiPinned = TILE_PIN_WEST | TILE_PIN_ROW | TILE_PIN_EAST;
+                continue;
+            }
 
-                _mm256_storeu_ps(&m_pfNextFrameData[iIndex], next);
+            uiPinned = 0;
+            const int iSrcRow = GetPaddedIndexOf3DLayer(0, iSrcY, iSrcZ);
+            const T* pOwnRow = GetRow(pRowChunk, iSrcRow);
+            if (pOwnRow) {
+                loadRow(pfTileRow + iGhost, pOwnRow, CHUNK_SIZE);
+            } else {
+                std::fill_n(pfTileRow + iGhost, CHUNK_SIZE, 0.0f);
+                uiPinned |= TILE_PIN_ROW;
             }
 
-            for (; iX < CHUNK_SIZE; ++iX, ++iIndex) {
-                float fCurrentTemp = m_pfCurrFrameData[iIndex];
-                float fNeighborSum =
-                    m_pfCurrFrameData[iIndex - 1] + m_pfCurrFrameData[iIndex + 1] +
-                    m_pfCurrFrameData[iIndex - iOffsetY] + m_pfCurrFrameData[iIndex + iOffsetY] +
-                    m_pfCurrFrameData[iIndex - iOffsetZ] + m_pfCurrFrameData[iIndex + iOffsetZ];
-                m_pfNextFrameData[iIndex] =
-                    fCurrentTemp + fCoefficient * (fNeighborSum - 6.0f * fCurrentTemp);
+            const Chunk* pWest = pRowChunk->m_pNeighbours[Direction::WEST];
+            const Chunk* pEast = pRowChunk->m_pNeighbours[Direction::EAST];
+            const T* pWestRow = GetRow(pWest, iSrcRow);
+            const T* pEastRow = GetRow(pEast, iSrcRow);
+            const bool bMirrorWest = !pWest && m_bVonNeumannBC && pOwnRow;
+            const bool bMirrorEast = !pEast && m_bVonNeumannBC && pOwnRow;
+            if (!pWestRow && !bMirrorWest)
+                uiPinned |= TILE_PIN_WEST;
+            if (!pEastRow && !bMirrorEast)
+                uiPinned |= TILE_PIN_EAST;
+            for (int iG = 1; iG <= iGhost; ++iG) {
+                pfTileRow[iGhost - iG] =
+                    pWestRow ? toFloat(pWestRow[CHUNK_SIZE - iG])
+                             : (bMirrorWest ? toFloat(pOwnRow[iG - 1]) : 0.0f);
+                pfTileRow[iGhost + CHUNK_SIZE - 1 + iG] =
+                    pEastRow ? toFloat(pEastRow[iG - 1])
+                             : (bMirrorEast ? toFloat(pOwnRow[CHUNK_SIZE - iG]) : 0.0f);
             }
         }
     }
+}
+//*********************************************************************
+void Chunk::ThermalStep_TemporalBlocked(float fThermalDiffusivity,
+                                        float fDeltaTime,
+                                        int iNbSubSteps,
+                                        bool bUseSIMD) {
+    if (!HasThermalData())
+        return;
+
+    const int iGhost = std::clamp(iNbSubSteps, 1, MAX_TEMPORAL_BLOCK_DEPTH);
+    const int iTileX = CHUNK_SIZE + 2 * iGhost;
+    const int iTileY = CHUNK_HEIGHT + 2 * iGhost;
+    const int iTileZ = CHUNK_SIZE + 2 * iGhost;
+    const int iTileVol = iTileX * iTileY * iTileZ;
+
+    // Per-thread scratch tiles, sized once for the deepest block (<= 32^3 floats each)
+    thread_local std::vector<float> vecTileA, vecTileB;
+    thread_local std::vector<uint8_t> vecPinned;
+    if (static_cast<int>(vecTileA.size()) < iTileVol) {
+        vecTileA.resize(iTileVol);
+        vecTileB.resize(iTileVol);
+        vecPinned.resize(static_cast<size_t>(iTileY * iTileZ));
+    }
+    float* pfSrc = vecTileA.data();
+    float* pfDst = vecTileB.data();
+    uint8_t* puiPinned = vecPinned.data();
+
+    // Gather: interior plus a ghost zone of width iGhost, converted to FP32 if stored as FP16
+    if (m_puiCurrFrameHalf)
+        gatherTile<HalfFloat>(pfSrc, puiPinned, iGhost, iTileX, iTileY, iTileZ);
+    else
+        gatherTile<float>(pfSrc, puiPinned, iGhost, iTileX, iTileY, iTileZ);
+
+    // Advance iGhost steps inside the tile; the valid region shrinks by one cell per step
+    const float fCoefficient = fThermalDiffusivity * fDeltaTime;
+    StencilRange objRange;
+    objRange.m_iStrideY = iTileX;
+    objRange.m_iStrideZ = iTileX * iTileY;
+    for (int iStep = 1; iStep <= iGhost; ++iStep) {
+        objRange.m_iBeginX = objRange.m_iBeginY = objRange.m_iBeginZ = iStep;
+        objRange.m_iEndX = iTileX - iStep;
+        objRange.m_iEndY = iTileY - iStep;
+        objRange.m_iEndZ = iTileZ - iStep;
+        // The last sweep covers exactly the interior, so its delta is the chunk's
+        if (bUseSIMD)
+            m_fLastMaxDelta =
+                ThermalKernels::StencilSweep_SIMD(pfSrc, pfDst, objRange, fCoefficient);
+        else
+            m_fLastMaxDelta = ThermalKernels::StencilSweep(pfSrc, pfDst, objRange, fCoefficient);
+        std::swap(pfSrc, pfDst);
+
+        // Cold neighbours are not stepped this frame: their cells stay at 0 K, as in FillHalo()
+        for (int iTileRow = 0; iTileRow < iTileY * iTileZ; ++iTileRow) {
+            const uint8_t uiPinned = puiPinned[iTileRow];
+            float* pfTileRow = &pfSrc[iTileRow * iTileX];
+            if (uiPinned & TILE_PIN_WEST)
+                std::fill_n(pfTileRow, iGhost, 0.0f);
+            if (uiPinned & TILE_PIN_ROW)
+                std::fill_n(pfTileRow + iGhost, CHUNK_SIZE, 0.0f);
+            if (uiPinned & TILE_PIN_EAST)
+                std::fill_n(pfTileRow + iGhost + CHUNK_SIZE, iGhost, 0.0f);
+        }
+    }
 
-    // Phase 2 : The Borders (Non-SIMD, Boundary Checks)
+    // Scatter the interior back into the padded next-frame buffer
     for (int iZ = 0; iZ < CHUNK_SIZE; ++iZ) {
         for (int iY = 0; iY < CHUNK_HEIGHT; ++iY) {
+            int iTileRow = (iY + iGhost) + (iZ + iGhost) * iTileY;
+            const float* pfTileRow = &pfSrc[iGhost + iTileRow * iTileX];
+            const int iRow = GetPaddedIndexOf3DLayer(0, iY, iZ);
+            if (m_puiNextFrameHalf)
+                storeRow(&m_puiNextFrameHalf[iRow], pfTileRow, CHUNK_SIZE);
+            else
+                storeRow(&m_pfNextFrameData[iRow], pfTileRow, CHUNK_SIZE);
+        }
+    }
+}
+//*********************************************************************
+void Chunk::UpdateThermalTexture(Renderer::ThermalAtlas& objAtlas,
+                                 Renderer::ThermalUploadRing* pUploadRing) {
+    // While an asynchronous update is in flight the live fields of active chunks belong to the
+    // workers, which swap them every step: those chunks upload their front snapshot, or nothing
+    // until they have one, and never touch the live pointers
+    const float* pfSnapshot = GetThermalSnapshot();
+    if (m_bThermalUpdateInFlight) {
+        if (!pfSnapshot)
+            return;
+    } else if (!HasThermalData()) {
+        return;  // Cold: the slot went back to the atlas with the buffers
+    }
+    // Until its first upload has landed a slot holds garbage or the field of its previous owner
+    if (!m_bThermalSlotFilled && m_uiSlotFillSerial > 0 && pUploadRing &&
+        pUploadRing->IsRetired(m_uiSlotFillSerial))
+        m_bThermalSlotFilled = true;
+    if (IsThermalTextureCurrent() && m_pThermalAtlas == &objAtlas)
+        return;
+    if (m_pThermalAtlas != &objAtlas) {
+        releaseThermalSlot();
+        m_iThermalSlot = objAtlas.AllocateSlot();
+        if (m_iThermalSlot < 0)
+            return;  // Atlas at its size limit: the chunk renders cold until a slot frees up
+        m_pThermalAtlas = &objAtlas;
+    }
+
+    // The halo is already in place (rebuilt by the thermal workers, see FillTextureHalo()). FP16
+    // fields upload as they are: half the bytes, widened by the driver. The snapshot is tested
+    // first so that an in-flight chunk never reads its live pointers
+    const bool bHalf = !pfSnapshot && m_puiCurrFrameHalf;
+    const void* pData = pfSnapshot ? static_cast<const void*>(pfSnapshot)
+                        : bHalf    ? static_cast<const void*>(m_puiCurrFrameHalf)
+                                   : static_cast<const void*>(m_pfCurrFrameData);
+    if (pUploadRing) {
+        const size_t iBytes = PADDED_CHUNK_VOL * (bHalf ? sizeof(HalfFloat) : sizeof(float));
+        const GLenum eType = bHalf ? GL_HALF_FLOAT : GL_FLOAT;
+        if (!pUploadRing->Upload(objAtlas, m_iThermalSlot, pData, iBytes, eType))
+            return;  // Ring busy or full this frame: retried next frame
+        if (m_uiSlotFillSerial == 0)
+            m_uiSlotFillSerial = pUploadRing->GetFrameSerial();
+    } else {
+        if (bHalf)
+            objAtlas.Update(m_iThermalSlot, static_cast<const HalfFloat*>(pData));
+        else
+            objAtlas.Update(m_iThermalSlot, static_cast<const float*>(pData));
+        m_bThermalSlotFilled = true;  // Copied from client memory before Update() returns
+    }
+    m_uiUploadedGeneration = m_uiThermalGeneration;
+}
+//*********************************************************************
+void Chunk::releaseThermalSlot() {
+    if (m_pThermalAtlas)
+        m_pThermalAtlas->FreeSlot(m_iThermalSlot);
+    m_pThermalAtlas = nullptr;
+    m_iThermalSlot = -1;
+    m_bThermalSlotFilled = false;
+    m_uiSlotFillSerial = 0;
+    m_uiUploadedGeneration = 0;
+}
+//*********************************************************************
+void Chunk::FillTextureHalo() {
+    if (m_pfCurrFrameData)
+        fillHalo<float>();
+    else if (m_puiCurrFrameHalf)
+        fillHalo<HalfFloat>();
+}
+//*********************************************************************
+void Chunk::WakeThermal() {
+    if (!HasThermalData())
+        allocateThermalBuffers();
+    m_bThermalActive = true;
+    ++m_uiThermalGeneration;
+}
+//*********************************************************************
+void Chunk::allocateThermalBuffers() {
+    if (m_eThermalStorage == ThermalStorage::FP16) {
+        size_t iRawBytes = PADDED_CHUNK_VOL * sizeof(HalfFloat);
+        size_t iAlignedBytes = (iRawBytes + 63) & ~63;
+        m_puiCurrFrameHalf = static_cast<HalfFloat*>(ALLOCATE_ALIGNED(iAlignedBytes, 64));
+        m_puiNextFrameHalf = static_cast<HalfFloat*>(ALLOCATE_ALIGNED(iAlignedBytes, 64));
+        std::fill_n(m_puiCurrFrameHalf, PADDED_CHUNK_VOL, HalfFloat{0});  // +0.0
+        std::fill_n(m_puiNextFrameHalf, PADDED_CHUNK_VOL, HalfFloat{0});
+        return;
+    }
+    size_t iRawBytes = PADDED_CHUNK_VOL * sizeof(float);
+    size_t iAlignedBytes = (iRawBytes + 63) & ~63;
+    m_pfCurrFrameData = static_cast<float*>(ALLOCATE_ALIGNED(iAlignedBytes, 64));
+    m_pfNextFrameData = static_cast<float*>(ALLOCATE_ALIGNED(iAlignedBytes, 64));
+    std::fill_n(m_pfCurrFrameData, PADDED_CHUNK_VOL, 0.0f);
+    std::fill_n(m_pfNextFrameData, PADDED_CHUNK_VOL, 0.0f);
+}
+//*********************************************************************
+void Chunk::SetThermalStorage(ThermalStorage eStorage) {
+    if (eStorage == m_eThermalStorage)
+        return;
+    m_eThermalStorage = eStorage;
+    if (!HasThermalData())
+        return;
+
+    // Only the current field carries state; the next one is overwritten by the following step
+    float* pfOldCurr = m_pfCurrFrameData;
+    float* pfOldNext = m_pfNextFrameData;
+    HalfFloat* puiOldCurr = m_puiCurrFrameHalf;
+    HalfFloat* puiOldNext = m_puiNextFrameHalf;
+    m_pfCurrFrameData = m_pfNextFrameData = nullptr;
+    m_puiCurrFrameHalf = m_puiNextFrameHalf = nullptr;
+    allocateThermalBuffers();
+    if (puiOldCurr)
+        ThermalKernels::ConvertToFloat(puiOldCurr, m_pfCurrFrameData, PADDED_CHUNK_VOL);
+    else
+        ThermalKernels::ConvertToHalf(pfOldCurr, m_puiCurrFrameHalf, PADDED_CHUNK_VOL);
+
+    FREE_ALIGNED(pfOldCurr);
+    FREE_ALIGNED(pfOldNext);
+    FREE_ALIGNED(puiOldCurr);
+    FREE_ALIGNED(puiOldNext);
+    ++m_uiThermalGeneration;
+}
+//*********************************************************************
+void Chunk::SleepThermal() {
+    m_bThermalActive = false;
+    // Nobody steps a sleeping chunk, so the texture pass can read its live field again
+    ReleaseThermalSnapshot();
+    if (!HasThermalData())
+        return;
+
+    for (int iZ = 0; iZ < CHUNK_SIZE; ++iZ) {
+        for (int iY = 0; iY < CHUNK_HEIGHT; ++iY) {
+            const int iRow = GetPaddedIndexOf3DLayer(0, iY, iZ);
             for (int iX = 0; iX < CHUNK_SIZE; ++iX) {
-                if (iX > 0 && iX < CHUNK_SIZE - 1 && iY > 0 && iY < CHUNK_HEIGHT - 1 && iZ > 0 &&
-                    iZ < CHUNK_SIZE - 1)
-                    continue;
-                int iIndex = GetFlatIndexOf3DLayer(iX, iY, iZ);
+                if (std::fabs(loadCell(iRow + iX)) >= THERMAL_COLD_TEMP)
+                    return;
+            }
+        }
+    }
+    // Residual heat below THERMAL_COLD_TEMP is dropped along with the buffers
+    releaseThermalBuffers();
+    ++m_uiThermalGeneration;
+}
+//*********************************************************************
+void Chunk::releaseThermalBuffers() {
+    FREE_ALIGNED(m_pfCurrFrameData);
+    FREE_ALIGNED(m_pfNextFrameData);
+    FREE_ALIGNED(m_puiCurrFrameHalf);
+    FREE_ALIGNED(m_puiNextFrameHalf);
+    m_pfCurrFrameData = nullptr;
+    m_pfNextFrameData = nullptr;
+    m_puiCurrFrameHalf = nullptr;
+    m_puiNextFrameHalf = nullptr;
+    m_vecCoarseCurr = std::vector<float>();
+    m_vecCoarseNext = std::vector<float>();
+    m_iThermalLod = 0;
+    ReleaseThermalSnapshot();
+    // The atlas slot goes with the field, whether or not the chunk is still in view
+    releaseThermalSlot();
+}
+//*********************************************************************
+float Chunk::GetMaxFaceDifference(Direction iDir) const {
+    const Chunk* pNeighbour = m_pNeighbours[iDir];
+    if (!pNeighbour)
+        return 0.0f;
+
+    const bool bOwnData = HasThermalData();
+    const bool bOtherData = pNeighbour->HasThermalData();
+    if (!bOwnData && !bOtherData)
+        return 0.0f;
+
+    // Face cells in (iU, iV) order for each direction: own boundary layer and the neighbour's
+    // adjacent layer on the other side of the face (every face is CHUNK_SIZE^2 cells)
+    static_assert(CHUNK_SIZE == CHUNK_HEIGHT, "Face walk assumes cubic chunks");
+    auto GetFaceIndices = [&](int iU, int iV, int& iOwn, int& iOther) {
+        switch (iDir) {
+            case Direction::WEST:
+                iOwn = GetPaddedIndexOf3DLayer(0, iU, iV);
+                iOther = GetPaddedIndexOf3DLayer(CHUNK_SIZE - 1, iU, iV);
+                break;
+            case Direction::EAST:
+                iOwn = GetPaddedIndexOf3DLayer(CHUNK_SIZE - 1, iU, iV);
+                iOther = GetPaddedIndexOf3DLayer(0, iU, iV);
+                break;
+            case Direction::BELOW:
+                iOwn = GetPaddedIndexOf3DLayer(iU, 0, iV);
+                iOther = GetPaddedIndexOf3DLayer(iU, CHUNK_HEIGHT - 1, iV);
+                break;
+            case Direction::ABOVE:
+                iOwn = GetPaddedIndexOf3DLayer(iU, CHUNK_HEIGHT - 1, iV);
+                iOther = GetPaddedIndexOf3DLayer(iU, 0, iV);
+                break;
+            case Direction::SOUTH:
+                iOwn = GetPaddedIndexOf3DLayer(iU, iV, 0);
+                iOther = GetPaddedIndexOf3DLayer(iU, iV, CHUNK_SIZE - 1);
+                break;
+            case Direction::NORTH:
+                iOwn = GetPaddedIndexOf3DLayer(iU, iV, CHUNK_SIZE - 1);
+                iOther = GetPaddedIndexOf3DLayer(iU, iV, 0);
+                break;
+        }
+    };
+
+    float fMaxDiff = 0.0f;
+    for (int iV = 0; iV < CHUNK_SIZE; ++iV) {
+        for (int iU = 0; iU < CHUNK_HEIGHT; ++iU) {
+            int iOwn = 0, iOther = 0;
+            GetFaceIndices(iU, iV, iOwn, iOther);
+            float fOwn = bOwnData ? loadCell(iOwn) : 0.0f;
+            float fOther = bOtherData ? pNeighbour->loadCell(iOther) : 0.0f;
+            fMaxDiff = std::max(fMaxDiff, std::fabs(fOwn - fOther));
+        }
+    }
+    return fMaxDiff;
+}
+//*********************************************************************
+StencilRange Chunk::GetCoarseStencilRange(int iLod) {
+    StencilRange objRange;
+    objRange.m_iStrideY = getCoarseSize(iLod) + 2;
+    objRange.m_iStrideZ = (getCoarseSize(iLod) + 2) * (getCoarseHeight(iLod) + 2);
+    objRange.m_iBeginX = 1;
+    objRange.m_iEndX = getCoarseSize(iLod) + 1;
+    objRange.m_iBeginY = 1;
+    objRange.m_iEndY = getCoarseHeight(iLod) + 1;
+    objRange.m_iBeginZ = 1;
+    objRange.m_iEndZ = getCoarseSize(iLod) + 1;
+    return objRange;
+}
+//*********************************************************************
+void Chunk::SetThermalLod(int iLod) {
+    iLod = std::clamp(iLod, 0, THERMAL_MAX_LOD);
+    if (iLod == m_iThermalLod || !HasThermalData())
+        return;
+
+    // Always go through the full-resolution field, so any level change is one restriction
+    ProlongateToFine();
+    m_iThermalLod = iLod;
+    ++m_uiThermalGeneration;
+    if (iLod == 0) {
+        m_vecCoarseCurr = std::vector<float>();
+        m_vecCoarseNext = std::vector<float>();
+        return;
+    }
 
-                float fCurrentTemp = m_pfCurrFrameData[iIndex];
-                float fNeighborSum =
-                    GetTemperatureAt(iX + 1, iY, iZ) + GetTemperatureAt(iX - 1, iY, iZ) +
-                    GetTemperatureAt(iX, iY + 1, iZ) + GetTemperatureAt(iX, iY - 1, iZ) +
-                    GetTemperatureAt(iX, iY, iZ + 1) + GetTemperatureAt(iX, iY, iZ - 1);
-                m_pfNextFrameData[iIndex] =
-                    fCurrentTemp + fCoefficient * (fNeighborSum - 6.0f * fCurrentTemp);
+    const int iFactor = 1 << iLod;
+    const size_t iPaddedVol = static_cast<size_t>(getCoarseSize(iLod) + 2) *
+                              (getCoarseHeight(iLod) + 2) * (getCoarseSize(iLod) + 2);
+    m_vecCoarseCurr.assign(iPaddedVol, 0.0f);
+    m_vecCoarseNext.assign(iPaddedVol, 0.0f);
+
+    // Restriction by cell means: the coarse cell holds exactly the heat of the voxels it covers
+    for (int iZ = 0; iZ < getCoarseSize(iLod); ++iZ) {
+        for (int iY = 0; iY < getCoarseHeight(iLod); ++iY) {
+            for (int iX = 0; iX < getCoarseSize(iLod); ++iX) {
+                float fSum = 0.0f;
+                for (int iDZ = 0; iDZ < iFactor; ++iDZ)
+                    for (int iDY = 0; iDY < iFactor; ++iDY)
+                        for (int iDX = 0; iDX < iFactor; ++iDX)
+                            fSum += loadCell(GetPaddedIndexOf3DLayer(
+                                iX * iFactor + iDX, iY * iFactor + iDY, iZ * iFactor + iDZ));
+                m_vecCoarseCurr[getCoarseIndex(iLod, iX, iY, iZ)] =
+                    fSum / static_cast<float>(iFactor * iFactor * iFactor);
             }
         }
     }
+
+    // The fine buffer now shows what the coarse grid holds
+    ProlongateToFine();
 }
 //*********************************************************************
-void Chunk::UpdateThermalTexture() {
-    for (int iZ = -1; iZ <= CHUNK_SIZE; ++iZ) {
-        for (int iY = -1; iY <= CHUNK_HEIGHT; ++iY) {
-            for (int iX = -1; iX <= CHUNK_SIZE; ++iX) {
-                if (iX >= 0 && iX < CHUNK_SIZE && iY >= 0 && iY < CHUNK_HEIGHT && iZ >= 0 &&
-                    iZ < CHUNK_SIZE)
-                    continue;
+void Chunk::ProlongateToFine() {
+    if (m_iThermalLod == 0 || !HasThermalData())
+        return;
 
-                m_pfCurrFrameData[GetPaddedIndexOf3DLayer(iX, iY, iZ)] =
-                    GetTemperatureAt(iX, iY, iZ);
+    // Piecewise constant: every voxel takes its coarse cell's value, so the heat is unchanged
+    const int iLod = m_iThermalLod;
+    float arrRow[CHUNK_SIZE];
+    for (int iZ = 0; iZ < CHUNK_SIZE; ++iZ) {
+        for (int iY = 0; iY < CHUNK_HEIGHT; ++iY) {
+            const float* pfCoarseRow =
+                &m_vecCoarseCurr[getCoarseIndex(iLod, 0, iY >> iLod, iZ >> iLod)];
+            for (int iX = 0; iX < CHUNK_SIZE; ++iX) arrRow[iX] = pfCoarseRow[iX >> iLod];
+            const int iRow = GetPaddedIndexOf3DLayer(0, iY, iZ);
+            if (m_puiCurrFrameHalf)
+                storeRow(&m_puiCurrFrameHalf[iRow], arrRow, CHUNK_SIZE);
+            else
+                storeRow(&m_pfCurrFrameData[iRow], arrRow, CHUNK_SIZE);
+        }
+    }
+}
+//*********************************************************************
+float Chunk::GetRestrictionError(int iLod) const {
+    iLod = std::clamp(iLod, 0, THERMAL_MAX_LOD);
+    if (iLod == 0 || !HasThermalData())
+        return 0.0f;
+
+    const int iFactor = 1 << iLod;
+    const float fInvCount = 1.0f / static_cast<float>(iFactor * iFactor * iFactor);
+    float arrBlock[1 << (3 * THERMAL_MAX_LOD)];
+    float fMaxError = 0.0f;
+    for (int iZ = 0; iZ < CHUNK_SIZE; iZ += iFactor) {
+        for (int iY = 0; iY < CHUNK_HEIGHT; iY += iFactor) {
+            for (int iX = 0; iX < CHUNK_SIZE; iX += iFactor) {
+                int iCount = 0;
+                float fSum = 0.0f;
+                for (int iDZ = 0; iDZ < iFactor; ++iDZ)
+                    for (int iDY = 0; iDY < iFactor; ++iDY)
+                        for (int iDX = 0; iDX < iFactor; ++iDX) {
+                            arrBlock[iCount] = loadCell(
+                                GetPaddedIndexOf3DLayer(iX + iDX, iY + iDY, iZ + iDZ));
+                            fSum += arrBlock[iCount++];
+                        }
+                const float fMean = fSum * fInvCount;
+                for (int i = 0; i < iCount; ++i)
+                    fMaxError = std::max(fMaxError, std::fabs(arrBlock[i] - fMean));
             }
         }
     }
-    if (!m_pThermalTex)
-        m_pThermalTex = std::make_unique<Renderer::ThermalVolume>(
-            PADDED_CHUNK_SIZE, PADDED_CHUNK_HEIGHT, PADDED_CHUNK_SIZE);
-    if (m_pThermalTex && m_pfCurrFrameData) {
-        m_pThermalTex->Update(m_pfCurrFrameData);
+    return fMaxError;
+}
+//*********************************************************************
+float Chunk::meanOverRegion(const int arrOrigin[3], const int arrSize[3]) const {
+    float fSum = 0.0f;
+    int iCount = 0;
+    if (m_iThermalLod == 0) {
+        for (int iZ = arrOrigin[2]; iZ < arrOrigin[2] + arrSize[2]; ++iZ)
+            for (int iY = arrOrigin[1]; iY < arrOrigin[1] + arrSize[1]; ++iY)
+                for (int iX = arrOrigin[0]; iX < arrOrigin[0] + arrSize[0]; ++iX, ++iCount)
+                    fSum += loadCell(GetPaddedIndexOf3DLayer(iX, iY, iZ));
+        return fSum / static_cast<float>(iCount);
     }
-}
\ No newline at end of file
+
+    // Boxes are aligned to the coarse cells or lie inside one, so each covered cell weighs the same
+    const int iLod = m_iThermalLod;
+    for (int iZ = arrOrigin[2] >> iLod; iZ <= (arrOrigin[2] + arrSize[2] - 1) >> iLod; ++iZ)
+        for (int iY = arrOrigin[1] >> iLod; iY <= (arrOrigin[1] + arrSize[1] - 1) >> iLod; ++iY)
+            for (int iX = arrOrigin[0] >> iLod; iX <= (arrOrigin[0] + arrSize[0] - 1) >> iLod;
+                 ++iX, ++iCount)
+                fSum += m_vecCoarseCurr[getCoarseIndex(iLod, iX, iY, iZ)];
+    return fSum / static_cast<float>(iCount);
+}
+//*********************************************************************
+float Chunk::interfaceGhost(Direction iDir, int iCX, int iCY, int iCZ, float fOwn) const {
+    // The neighbour's side of the face is its boundary layer (one of its cells thick) under our
+    // cell. Placing the ghost so that (ghost - own) / h_own equals the two-point gradient over the
+    // distance between both cell centres, (h_own + h_other) / 2, makes both sides see the same
+    // flux: the exchange is exactly conservative whatever the two resolutions are.
+    const Chunk* pNeighbour = m_pNeighbours[iDir];
+    const int iOwnFactor = 1 << m_iThermalLod;
+    const int iOtherFactor = 1 << pNeighbour->m_iThermalLod;
+    const int arrExtent[3] = {CHUNK_SIZE, CHUNK_HEIGHT, CHUNK_SIZE};
+
+    int arrOrigin[3] = {iCX * iOwnFactor, iCY * iOwnFactor, iCZ * iOwnFactor};
+    int arrSize[3] = {iOwnFactor, iOwnFactor, iOwnFactor};
+    for (int iAxis = 0; iAxis < 3; ++iAxis) {
+        const int iNormal = FACE_NORMALS[iDir][iAxis];
+        if (iNormal == 0)
+            continue;
+        arrOrigin[iAxis] = iNormal > 0 ? 0 : arrExtent[iAxis] - iOtherFactor;
+        arrSize[iAxis] = iOtherFactor;
+    }
+
+    const float fOther = pNeighbour->meanOverRegion(arrOrigin, arrSize);
+    const float fWeight = 2.0f * static_cast<float>(iOwnFactor) /
+                          static_cast<float>(iOwnFactor + iOtherFactor);
+    return fOwn + (fOther - fOwn) * fWeight;
+}
+//*********************************************************************
+void Chunk::fillCoarseHalo() {
+    const int iLod = m_iThermalLod;
+    const int iSize = getCoarseSize(iLod);
+    const int iHeight = getCoarseHeight(iLod);
+    float* pfCurr = m_vecCoarseCurr.data();
+
+    for (int iDir = 0; iDir < 6; ++iDir) {
+        const Direction eDir = static_cast<Direction>(iDir);
+        const Chunk* pNeighbour = m_pNeighbours[eDir];
+        const bool bLinked = pNeighbour && pNeighbour->HasThermalData();
+        const int* arrNormal = FACE_NORMALS[eDir];
+        forEachFaceCell(eDir, iSize, iHeight, iSize, [&](int iX, int iY, int iZ) {
+            // A linked but cold neighbour is at 0 K; only a missing one mirrors
+            const float fOwn = pfCurr[getCoarseIndex(iLod, iX, iY, iZ)];
+            float fGhost = (m_bVonNeumannBC && !pNeighbour) ? fOwn : 0.0f;
+            if (bLinked)
+                fGhost = interfaceGhost(eDir, iX, iY, iZ, fOwn);
+            pfCurr[getCoarseIndex(iLod, iX + arrNormal[0], iY + arrNormal[1], iZ + arrNormal[2])] =
+                fGhost;
+        });
+    }
+}
+//*********************************************************************
+void Chunk::fillLodInterfaceHalo() {
+    // fillHalo() copied the neighbour's prolonged field; faces towards coarse neighbours need the
+    // conservative interface value instead
+    for (int iDir = 0; iDir < 6; ++iDir) {
+        const Direction eDir = static_cast<Direction>(iDir);
+        const Chunk* pNeighbour = m_pNeighbours[eDir];
+        if (!pNeighbour || !pNeighbour->HasThermalData() || pNeighbour->m_iThermalLod == 0)
+            continue;
+        const int* arrNormal = FACE_NORMALS[eDir];
+        forEachFaceCell(eDir, CHUNK_SIZE, CHUNK_HEIGHT, CHUNK_SIZE, [&](int iX, int iY, int iZ) {
+            const float fOwn = loadCell(GetPaddedIndexOf3DLayer(iX, iY, iZ));
+            storeCell(GetPaddedIndexOf3DLayer(iX + arrNormal[0], iY + arrNormal[1],
+                                              iZ + arrNormal[2]),
+                      interfaceGhost(eDir, iX, iY, iZ, fOwn));
+        });
+    }
+}
+//*********************************************************************
+void Chunk::stepCoarse(float fCoefficient, bool bUseSIMD) {
+    // Cells are 2^LOD voxels wide: the same stencil with the coefficient scaled by 1 / h^2
+    const float fFactor = static_cast<float>(1 << m_iThermalLod);
+    const float fCoarseCoefficient = fCoefficient / (fFactor * fFactor);
+    const StencilRange objRange = GetCoarseStencilRange(m_iThermalLod);
+    if (bUseSIMD)
+        m_fLastMaxDelta = ThermalKernels::StencilSweep_SIMD(m_vecCoarseCurr.data(),
+                                                            m_vecCoarseNext.data(),
+                                                            objRange,
+                                                            fCoarseCoefficient);
+    else
+        m_fLastMaxDelta = ThermalKernels::StencilSweep(m_vecCoarseCurr.data(),
+                                                       m_vecCoarseNext.data(),
+                                                       objRange,
+                                                       fCoarseCoefficient);
+}
+//*********************************************************************
+void Chunk::PublishThermalSnapshot() {
+    if (!HasThermalData())
+        return;
+    std::vector<float>& vecBack = m_arrSnapshots[m_iSnapshotFront ^ 1];
+    vecBack.resize(PADDED_CHUNK_VOL);  // Allocates on the first publish only
+    if (m_puiCurrFrameHalf)
+        ThermalKernels::ConvertToFloat(m_puiCurrFrameHalf, vecBack.data(), PADDED_CHUNK_VOL);
+    else
+        std::memcpy(vecBack.data(), m_pfCurrFrameData, PADDED_CHUNK_VOL * sizeof(float));
+    m_bSnapshotPending = true;
+}
+//*********************************************************************
+void Chunk::FlipThermalSnapshot() {
+    if (!m_bSnapshotPending)
+        return;
+    m_iSnapshotFront ^= 1;
+    m_bSnapshotPending = false;
+    ++m_uiThermalGeneration;
+}
+//*********************************************************************
+void Chunk::ReleaseThermalSnapshot() {
+    if (m_arrSnapshots[0].empty() && m_arrSnapshots[1].empty())
+        return;
+    m_arrSnapshots[0] = std::vector<float>();
+    m_arrSnapshots[1] = std::vector<float>();
+    m_iSnapshotFront = 0;
+    m_bSnapshotPending = false;
+    ++m_uiThermalGeneration;
+}
@@ -6,31 +6,140 @@
 #pragma once
 
 #include <FastNoiseLite.h>
-#include <immintrin.h>
 #include <cstdint>
 #include <cstring>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "../core/MathUtils.h"
 #include "../physics/AABB.h"
-#include "../renderer/Buffer.h"
-#include "../renderer/IndexBuffer.h"
-#include "../renderer/ThermalVolume.h"
-#include "../renderer/VertexArray.h"
+#include "../physics/ThermalKernels.h"
+#include "../renderer/GeometryArena.h"
+#include "../renderer/ThermalUploadRing.h"
 
 constexpr int CHUNK_SIZE = 16;
 constexpr int CHUNK_HEIGHT = 16;
 constexpr int CHUNK_VOL = CHUNK_SIZE * CHUNK_HEIGHT * CHUNK_SIZE;
 
+// Occlusion culling: each chunk offers one occluder box per cell of OCCLUDER_CELL_SIZE^2 columns
+constexpr int OCCLUDER_CELL_SIZE = 4;
+constexpr int OCCLUDER_CELLS = CHUNK_SIZE / OCCLUDER_CELL_SIZE;
+
 constexpr int PADDED_CHUNK_SIZE = CHUNK_SIZE + 2;
 constexpr int PADDED_CHUNK_HEIGHT = CHUNK_HEIGHT + 2;
 constexpr int PADDED_CHUNK_VOL = PADDED_CHUNK_SIZE * PADDED_CHUNK_HEIGHT * PADDED_CHUNK_SIZE;
 
+// Deepest temporal block: the ghost zone must stay within the direct neighbours
+constexpr int MAX_TEMPORAL_BLOCK_DEPTH = 8;
+
+// Active-set thresholds: a chunk sleeps once no cell changes by more than THERMAL_SLEEP_DELTA per
+// substep, and releases its buffers when every cell is below THERMAL_COLD_TEMP
+constexpr float THERMAL_SLEEP_DELTA = 1e-3f;
+constexpr float THERMAL_COLD_TEMP = 1e-2f;
+
+// Thermal LOD: level L simulates on a (CHUNK_SIZE >> L)^3 grid of 2^L-voxel cells. A chunk is only
+// coarsened while no cell deviates from its coarse cell's mean by more than THERMAL_LOD_TOLERANCE.
+// That test is a pass over the whole field: a chunk that fails it is only re-tested
+// THERMAL_LOD_RECHECK_INTERVAL thermal updates later
+constexpr int THERMAL_MAX_LOD = 2;
+constexpr float THERMAL_LOD_TOLERANCE = 0.5f;
+constexpr uint64_t THERMAL_LOD_RECHECK_INTERVAL = 8;
+
+// Mesh LOD: level L meshes cubes of 2^L blocks, (CHUNK_SIZE >> L)^2 x (CHUNK_HEIGHT >> L) cells
+constexpr int MESH_MAX_LOD = 3;
+static_assert((CHUNK_SIZE >> MESH_MAX_LOD) > 0 && (CHUNK_HEIGHT >> MESH_MAX_LOD) > 0,
+              "The coarsest mesh LOD needs at least one cell per axis");
+
+constexpr int TEXTURE_ATLAS_TILES = 16;  // Tiles per atlas row and column
+
+// Packed mesh face, one 32-bit word per visible quad, pulled by vertex_Chunk.glsl through
+// gl_VertexID: chunk-local origin cell X, Y, Z (4 bits each), extent - 1 along the face's U and V
+// axes (4 bits each), the FaceDirection (3 bits) and the texture atlas tile (8 bits). The shader
+// expands the corners, places them at its draw's chunk offset and derives U/V (in blocks) from them
+using ChunkFace = uint32_t;
+constexpr int FACE_POS_BITS = 4;
+constexpr int FACE_SIZE_SHIFT = 3 * FACE_POS_BITS;
+constexpr int FACE_DIR_SHIFT = FACE_SIZE_SHIFT + 2 * FACE_POS_BITS;
+constexpr int FACE_TILE_SHIFT = FACE_DIR_SHIFT + 3;
+static_assert(CHUNK_SIZE <= (1 << FACE_POS_BITS) && CHUNK_HEIGHT <= (1 << FACE_POS_BITS),
+              "Chunk cells and quad extents must fit the packed face");
+static_assert(TEXTURE_ATLAS_TILES * TEXTURE_ATLAS_TILES <= 256, "Atlas tile must fit 8 bits");
+
+// Most faces a chunk can emit (every block, all six faces): sizes the shared quad index buffer
+constexpr int MAX_CHUNK_FACES = CHUNK_VOL * 6;
+
+constexpr ChunkFace PackChunkFace(
+    int iX, int iY, int iZ, int iSizeU, int iSizeV, int iFace, int iTile) {
+    return static_cast<ChunkFace>(
+        iX | (iY << FACE_POS_BITS) | (iZ << (2 * FACE_POS_BITS)) |
+        ((iSizeU - 1) << FACE_SIZE_SHIFT) | ((iSizeV - 1) << (FACE_SIZE_SHIFT + FACE_POS_BITS)) |
+        (iFace << FACE_DIR_SHIFT) | (iTile << FACE_TILE_SHIFT));
+}
+constexpr int UnpackFaceOrigin(ChunkFace uiFace, int iAxis) {
+    return static_cast<int>(uiFace >> (iAxis * FACE_POS_BITS)) & ((1 << FACE_POS_BITS) - 1);
+}
+constexpr int UnpackFaceSizeU(ChunkFace uiFace) {
+    return (static_cast<int>(uiFace >> FACE_SIZE_SHIFT) & ((1 << FACE_POS_BITS) - 1)) + 1;
+}
+constexpr int UnpackFaceSizeV(ChunkFace uiFace) {
+    return UnpackFaceSizeU(uiFace >> FACE_POS_BITS);
+}
+constexpr int UnpackFaceDirection(ChunkFace uiFace) {
+    return static_cast<int>(uiFace >> FACE_DIR_SHIFT) & 7;
+}
+constexpr int UnpackFaceTile(ChunkFace uiFace) {
+    return static_cast<int>(uiFace >> FACE_TILE_SHIFT) & 0xFF;
+}
+
+/**
+ * @brief Chunk-local position of corner iCorner (0..3, counter-clockwise around the outward
+ * normal) of a packed face, as vertex_Chunk.glsl expands it.
+ */
+void GetChunkFaceCorner(ChunkFace uiFace, int iCorner, int arrCorner[3]);
+
 enum FaceDirection { FRONT, BACK, LEFT, RIGHT, UP, DOWN };
 enum Direction { NORTH = 0, SOUTH, EAST, WEST, ABOVE, BELOW };  // Z+, Z-, X+, X-, Y+, Y-
 enum BlockType { AIR = 0, GRASS = 1, DIRT = 2, STONE = 3 };
 
+/**
+ * @brief NAIVE emits one quad per visible block face; GREEDY merges coplanar faces with the same
+ * atlas tile into maximal rectangles.
+ */
+enum class MeshingMode { NAIVE = 0, GREEDY };
+
+// Longest chunk axis: the binary mesher keeps one occupancy column per axis in 32 bits
+constexpr int MESH_MAX_DIM = CHUNK_SIZE > CHUNK_HEIGHT ? CHUNK_SIZE : CHUNK_HEIGHT;
+static_assert(MESH_MAX_DIM + 2 <= 32, "Occupancy columns (with border) must fit 32 bits");
+
+/**
+ * @struct ChunkMeshInput
+ * @brief Read-only copy of everything the mesher reads: the chunk's blocks and the one-voxel
+ * border of its linked neighbours. Taken on the main thread, so meshing jobs never touch live
+ * chunks or their m_pNeighbours.
+ */
+struct ChunkMeshInput {
+    uint8_t m_arrBlocks[CHUNK_VOL];
+    // Per Direction, the neighbour's boundary layer touching this chunk: bit Q of row P is set
+    // when its cell is solid, P and Q being the coordinates along the axes following the face
+    // normal's axis (mod 3), in cells of level m_iLod. All zero (air) without a neighbour at the
+    // same level
+    uint32_t m_arrBorders[6][MESH_MAX_DIM];
+    int m_iLod = 0;  // Mesh LOD to build
+};
+
+/**
+ * @struct ChunkMesh
+ * @brief Self-contained CPU mesh built by Chunk::BuildMesh(), owned by no chunk until SetMesh().
+ */
+struct ChunkMesh {
+    std::vector<ChunkFace> m_vecFaces;
+    // Faces are grouped by FaceDirection, in enum order: direction d is faces
+    // [m_arrDirectionStarts[d], m_arrDirectionStarts[d + 1])
+    unsigned int m_arrDirectionStarts[7] = {};
+    int m_iLod = 0;  // Mesh LOD it was built at
+};
+
 /**
  * @class Chunk
  * @brief Manages voxel block data, procedural mesh generation, and memory-aligned thermal diffusion
@@ -51,17 +160,51 @@ public:
     [[nodiscard]] int GetChunkX() const { return m_iChunkX; }
     [[nodiscard]] int GetChunkZ() const { return m_iChunkZ; }
 
-    [[nodiscard]] bool IsValid() const { return m_pVAO != nullptr; }
+    [[nodiscard]] bool IsValid() const { return m_pGeometryArena != nullptr; }
     const uint8_t* GetBlockData() const { return m_iBlocks; }
 
     // --- Core Logic ---
 
     /**
-     * @brief Generates the AABB for the entire chunk based on max height.
+     * @brief World-space box around the chunk's solid blocks (full X/Z extent, lowest to highest
+     * solid layer, rounded out to whole cells of a coarse mesh). Cached: every block write keeps
+     * the layer range current.
      */
     AABB GetAABB() const;
 
-    void Render() const;
+    /**
+     * @brief Conservative occluder of a cell (OCCLUDER_CELL_SIZE^2 columns): every column of the
+     * cell is solid from y = 0 up to this height (0: no occluder). Cached like the AABB.
+     */
+    int GetOccluderHeight(int iCellX, int iCellZ) const {
+        return m_arrOccluderHeights[iCellX][iCellZ];
+    }
+
+    /**
+     * @brief Uploaded faces: [offset, offset + count) in the geometry arena, drawn by
+     * WorldRenderer::DrawChunks as one command of its multi-draw-indirect call.
+     */
+    unsigned int GetMeshFaceOffset() const { return m_objMeshRange.m_uiOffset; }
+    unsigned int GetMeshFaceCount() const { return m_uiNbUploadedFaces; }
+    /**
+     * @brief First uploaded face of FaceDirection iDir in the geometry arena; iDir = 6 gives the
+     * end of the last direction. Directions follow each other in FaceDirection order.
+     */
+    unsigned int GetMeshDirectionStart(int iDir) const {
+        return m_objMeshRange.m_uiOffset + m_arrUploadedDirectionStarts[iDir];
+    }
+
+    /**
+     * @brief Mesh LOD of the next rebuild (0: full resolution, up to MESH_MAX_LOD), picked by
+     * ChunkManager from the distance to the player. Borders towards a neighbour at another level
+     * are meshed as if facing air, so either side closes the seam with a skirt of boundary faces.
+     */
+    void SetMeshLod(int iLod) { m_iMeshLod = iLod; }
+    [[nodiscard]] int GetMeshLod() const { return m_iMeshLod; }
+    /**
+     * @brief Mesh LOD of the faces in the geometry arena.
+     */
+    [[nodiscard]] int GetUploadedMeshLod() const { return m_iUploadedMeshLod; }
 
     void SetNeighbours(Direction iDir, Chunk* pChunk) { m_pNeighbours[iDir] = pChunk; }
 
@@ -86,21 +229,6 @@ public:
                ((iZ + 1) * PADDED_CHUNK_SIZE * PADDED_CHUNK_HEIGHT);
     }
 
-    // --- Block Manipulation for SIMD ---
-
-    [[nodiscard]] inline __m256i GetFlatIndexOf3DLayer_AVX2(__m256i vecX,
-                                                            __m256i vecY,
-                                                            __m256i vecZ) const {
-        __m256i vecChunkSize = _mm256_set1_epi32(CHUNK_SIZE);
-        __m256i vecChunkSizeHeight = _mm256_set1_epi32(CHUNK_SIZE * CHUNK_HEIGHT);
-
-        __m256i vecIndex =
-            _mm256_add_epi32(_mm256_add_epi32(vecX, _mm256_mullo_epi32(vecY, vecChunkSize)),
-                             _mm256_mullo_epi32(vecZ, vecChunkSizeHeight));
-
-        return vecIndex;
-    }
-
     /**
      * @brief Gets a block ID. Handles boundary checks by querying neighbors.
      */
@@ -145,59 +273,356 @@ public:
     void SetBlockAt(int iX, int iY, int iZ, uint8_t uiBlockType);
 
     void SetBlockData(const uint8_t* iBlocks) {
-        if (iBlocks)
+        if (iBlocks) {
             std::memcpy(m_iBlocks, iBlocks, CHUNK_VOL * sizeof(uint8_t));
+            updateSolidRange();
+        }
     }
 
     float GetTemperatureAt(int iX, int iY, int iZ) const;
 
-    void ReconstructMesh(bool bEnableNeighborCulling = false);
-    void UploadMesh();
-    void SwapBuffers() { std::swap(m_pfCurrFrameData, m_pfNextFrameData); }
+    /**
+     * @brief Halo exchange: copies the neighbours' boundary faces into the padded ring of the
+     * current buffer. A linked neighbour that is still cold (no buffers) is at 0 K. Faces without
+     * a linked neighbour mirror the chunk's own boundary layer (Von Neumann zero-flux) or are
+     * zeroed (Dirichlet). Must run before ThermalStep/ThermalStep_SIMD.
+     */
+    void FillHalo();
+
+    /**
+     * @brief TakeMeshInput + BuildMesh + SetMesh on the calling thread.
+     */
+    void ReconstructMesh(bool bEnableNeighborCulling = false,
+                         MeshingMode eMode = MeshingMode::NAIVE);
+
+    /**
+     * @brief Main thread: snapshots the blocks and the linked neighbours' borders.
+     */
+    void TakeMeshInput(ChunkMeshInput& objInput) const;
+
+    /**
+     * @brief Meshes a snapshot into objMesh (cleared first). Touches no chunk, so it runs on any
+     * thread. Chunk-local faces make the result independent of the chunk's position.
+     */
+    static void BuildMesh(const ChunkMeshInput& objInput,
+                          bool bEnableNeighborCulling,
+                          MeshingMode eMode,
+                          ChunkMesh& objMesh);
+
+    /**
+     * @brief Takes over a built mesh as the CPU-side mesh for the next UploadMesh().
+     */
+    void SetMesh(ChunkMesh&& objMesh);
+    /**
+     * @brief Writes the CPU-side mesh into this chunk's range of objArena, in place while it fits,
+     * otherwise into a new range (the old one is freed). The chunk keeps its range until it is
+     * destroyed, so objArena must outlive it.
+     * @return false when the arena is at its size limit: the chunk draws nothing and keeps the
+     * mesh for another UploadMesh() once ranges have been freed (see HasRefusedMesh()).
+     */
+    bool UploadMesh(Renderer::GeometryArena& objArena);
+    [[nodiscard]] bool HasRefusedMesh() const { return m_bMeshUploadRefused; }
+    /**
+     * @brief CPU-side mesh built by ReconstructMesh() or set by SetMesh(), emptied again by a
+     * successful UploadMesh().
+     */
+    const std::vector<ChunkFace>& GetMeshFaces() const { return m_vec_uiFaces; }
+    void SwapBuffers() {
+        std::swap(m_pfCurrFrameData, m_pfNextFrameData);
+        std::swap(m_puiCurrFrameHalf, m_puiNextFrameHalf);
+        m_vecCoarseCurr.swap(m_vecCoarseNext);
+    }
     void InjectHeat(int iX, int iY, int iZ, float fTemp) {
         int iIndex = GetPaddedIndexOf3DLayer(iX, iY, iZ);
         if (iIndex != -1) {
-            m_pfCurrFrameData[iIndex] = fTemp;
+            WakeThermal();
+            SetThermalLod(0);  // A point source needs the full resolution
+            storeCell(iIndex, fTemp);
         }
     }
+
+    // --- Thermal Active Set ---
+
+    /**
+     * @brief Allocates the (zeroed) thermal buffers on first use and marks the chunk active, so
+     * ThermalSystem steps it from the next update on.
+     */
+    void WakeThermal();
+
+    /**
+     * @brief Stops stepping the chunk. Buffers are kept while any cell still holds heat (they are
+     * the neighbours' boundary condition) and released once the whole field is cold, together with
+     * the chunk's thermal atlas slot.
+     */
+    void SleepThermal();
+
+    [[nodiscard]] bool IsThermalActive() const { return m_bThermalActive; }
+    [[nodiscard]] bool HasThermalData() const {
+        return m_pfCurrFrameData != nullptr || m_puiCurrFrameHalf != nullptr;
+    }
+
+    /**
+     * @brief Converts the existing fields (if any) to eStorage; later allocations use it too.
+     * FP16 halves the memory traffic of every step and the texture upload, at ~3 significant
+     * digits. All linked chunks must share the storage while ThermalSystem steps them.
+     */
+    void SetThermalStorage(ThermalStorage eStorage);
+    [[nodiscard]] ThermalStorage GetThermalStorage() const { return m_eThermalStorage; }
+
+    // --- Thermal LOD ---
+
+    /**
+     * @brief Switches the simulation grid to level iLod (0 = full resolution). Coarsening
+     * restricts the field to cell means, refining prolongs it piecewise constant: both keep the
+     * total heat. Chunks without buffers stay at level 0.
+     */
+    void SetThermalLod(int iLod);
+    [[nodiscard]] int GetThermalLod() const { return m_iThermalLod; }
+
+    /**
+     * @brief Largest |T - mean of its level-iLod cell| over the chunk, i.e. what coarsening to
+     * iLod would smear out.
+     */
+    [[nodiscard]] float GetRestrictionError(int iLod) const;
+    /**
+     * @brief First thermal update (ThermalSystem epoch) at which the chunk may be tested for
+     * coarsening again.
+     */
+    [[nodiscard]] uint64_t GetLodRecheckEpoch() const { return m_uiLodRecheckEpoch; }
+    void SetLodRecheckEpoch(uint64_t uiEpoch) { m_uiLodRecheckEpoch = uiEpoch; }
+
+    /**
+     * @brief Copies the coarse field into the full-resolution buffer (piecewise constant), which
+     * rendering, probes and the wake/sleep tests read. Must follow every update of a coarse chunk.
+     */
+    void ProlongateToFine();
+
+    // --- Published snapshot (asynchronous thermal updates) ---
+
+    /**
+     * @brief Worker side, end of an asynchronous update: copies the current field (as FP32) into
+     * the back snapshot slot, while the renderer may still read the front one.
+     */
+    void PublishThermalSnapshot();
+    /**
+     * @brief Main thread, no update in flight: the last published slot becomes the front one.
+     */
+    void FlipThermalSnapshot();
+    void ReleaseThermalSnapshot();
+    /**
+     * @brief Main thread, around an asynchronous update that steps this chunk: while set, the
+     * live fields belong to the workers and the texture pass only ever reads the front snapshot.
+     */
+    void SetThermalUpdateInFlight(bool bInFlight) { m_bThermalUpdateInFlight = bInFlight; }
+    [[nodiscard]] bool IsThermalUpdateInFlight() const { return m_bThermalUpdateInFlight; }
+    [[nodiscard]] bool HasThermalSnapshot() const {
+        return !m_arrSnapshots[m_iSnapshotFront].empty();
+    }
+    /**
+     * @brief Front snapshot (padded layout), nullptr when the texture pass reads the live field.
+     */
+    [[nodiscard]] const float* GetThermalSnapshot() const {
+        return HasThermalSnapshot() ? m_arrSnapshots[m_iSnapshotFront].data() : nullptr;
+    }
+
+    /**
+     * @brief Largest |dT| of a cell during the last ThermalStep* call (last substep of a block) or
+     * implicit solve.
+     */
+    [[nodiscard]] float GetLastMaxDelta() const { return m_fLastMaxDelta; }
+    void SetLastMaxDelta(float fMaxDelta) { m_fLastMaxDelta = fMaxDelta; }
+
+    /**
+     * @brief Largest temperature difference across the face towards iDir, i.e. between our
+     * boundary layer and the neighbour's adjacent layer (0 for a neighbour without buffers).
+     * Returns 0 when there is no neighbour in that direction.
+     */
+    [[nodiscard]] float GetMaxFaceDifference(Direction iDir) const;
+
+    [[nodiscard]] Chunk* GetNeighbour(Direction iDir) const { return m_pNeighbours[iDir]; }
+
+    /**
+     * @brief Bumps the thermal generation (own data or a neighbour's halo changed): the texture
+     * is re-uploaded once its uploaded generation falls behind.
+     */
+    void MarkThermalDirty() { ++m_uiThermalGeneration; }
+    [[nodiscard]] uint64_t GetThermalGeneration() const { return m_uiThermalGeneration; }
+    [[nodiscard]] bool IsThermalTextureCurrent() const {
+        return m_uiUploadedGeneration == m_uiThermalGeneration;
+    }
+
+    /**
+     * @brief Rebuilds the full-resolution halo for the texture (neighbour faces, 0 K for cold
+     * neighbours, mirrored or zeroed where there are none) from the neighbours' current fields.
+     * Memcpy-based like FillHalo(), without the LOD interface values; reads only the neighbours'
+     * interior cells.
+     */
+    void FillTextureHalo();
+    /**
+     * @brief 7-point explicit diffusion step over all 16^3 cells (or the coarse grid of a chunk at
+     * LOD > 0). Reads neighbours only through the padded halo, so FillHalo() must have been called
+     * for the current buffer.
+     */
     void ThermalStep(float fThermalDiffusivity, float fDeltaTime);
-    void ThermalStep_AVX2(float fThermalDiffusivity, float fDeltaTime);
+    /**
+     * @brief Same step through the widest ISA selected at runtime (ThermalKernels::SelectIsa).
+     */
+    void ThermalStep_SIMD(float fThermalDiffusivity, float fDeltaTime);
 
+    /**
+     * @brief Temporally blocked kernel: advances iNbSubSteps explicit steps in one pass by
+     * gathering a ghost zone of width iNbSubSteps into a per-thread tile that stays in L1/L2.
+     * Reads the neighbours' current buffers directly (no FillHalo needed) and writes the result to
+     * the next buffer, so it is equivalent to iNbSubSteps FillHalo/ThermalStep/SwapBuffers rounds.
+     * Full-resolution only: neither the chunk nor any neighbour may be at LOD > 0.
+     */
+    void ThermalStep_TemporalBlocked(float fThermalDiffusivity,
+                                     float fDeltaTime,
+                                     int iNbSubSteps,
+                                     bool bUseSIMD = true);
+
+    /**
+     * @brief Padded fields of the active storage; the accessors of the other one return nullptr.
+     */
     float* GetCurrData() const { return m_pfCurrFrameData; }
-    void UpdateThermalTexture();
-    void Bind(int iVal) {
-        if (m_pThermalTex)
-            m_pThermalTex->Bind(iVal);
-    }
+    float* GetNextData() const { return m_pfNextFrameData; }
+    HalfFloat* GetCurrHalfData() const { return m_puiCurrFrameHalf; }
+    HalfFloat* GetNextHalfData() const { return m_puiNextFrameHalf; }
+    [[nodiscard]] bool IsVonNeumannBC() const { return m_bVonNeumannBC; }
+
+    /**
+     * @brief The 16^3 interior of the padded layout, as swept by the stencil kernels.
+     */
+    static StencilRange GetInteriorStencilRange();
+    /**
+     * @brief Interior of the padded (CHUNK_SIZE >> iLod + 2)^3 layout of a coarse field.
+     */
+    static StencilRange GetCoarseStencilRange(int iLod);
+    /**
+     * @brief Re-uploads the padded field (front snapshot if there is one, halo included) into
+     * this chunk's atlas slot when its generation changed, taking a slot on the first upload.
+     * Streams through pUploadRing when given; if the ring is out of space the upload stays pending
+     * for a later frame, and a new slot is only sampled once the ring has retired its first upload.
+     * Cold chunks without buffers upload nothing (their slot went back with the buffers).
+     */
+    void UpdateThermalTexture(Renderer::ThermalAtlas& objAtlas,
+                              Renderer::ThermalUploadRing* pUploadRing = nullptr);
+    /**
+     * @brief Atlas slot to sample, or -1 (cold) until the chunk's field has landed in it.
+     */
+    [[nodiscard]] int GetThermalSlot() const { return m_bThermalSlotFilled ? m_iThermalSlot : -1; }
 
     void GetMeshStats(size_t& uiOutVertCount, size_t& uiOutTriCount) const {
         uiOutVertCount = m_uiVertexCount;
         uiOutTriCount = m_uiTriangleCount;
     }
+    /**
+     * @brief Bytes of the uploaded faces.
+     */
+    size_t GetMeshByteSize() const { return m_uiMeshBytes; }
+
+    /**
+     * @brief Dirty flag behind ChunkManager's deduplicated remesh queue.
+     * @return true when the chunk was clean, i.e. not queued yet.
+     */
+    bool MarkMeshDirty() { return !std::exchange(m_bMeshDirty, true); }
+    bool IsMeshDirty() const { return m_bMeshDirty; }
+    void ClearMeshDirty() { m_bMeshDirty = false; }
 
 private:
-    std::vector<float> m_vec_fVertices;
-    std::vector<unsigned int> m_vec_uiIndices;
+    std::vector<ChunkFace> m_vec_uiFaces;
+    unsigned int m_arrMeshDirectionStarts[7] = {};  // Of m_vec_uiFaces
+    int m_iFacesLod = 0;                            // Of m_vec_uiFaces
     size_t m_uiVertexCount = 0;
     size_t m_uiTriangleCount = 0;
-    Renderer::VertexArray* m_pVAO = nullptr;
-    Renderer::VertexBuffer* m_pVBO = nullptr;
-    Renderer::IndexBuffer* m_pIBO = nullptr;
+    size_t m_uiMeshBytes = 0;
+    bool m_bMeshDirty = false;
+    bool m_bMeshUploadRefused = false;  // m_vec_uiFaces is still waiting for an arena range
+    Renderer::GeometryArena* m_pGeometryArena = nullptr;
+    Renderer::GeometryArena::Range m_objMeshRange;
+    unsigned int m_uiNbUploadedFaces = 0;
+    unsigned int m_arrUploadedDirectionStarts[7] = {};  // Relative to m_objMeshRange
+    int m_iMeshLod = 0;
+    int m_iUploadedMeshLod = 0;
 
     Chunk* m_pNeighbours[6] = {nullptr};
 
     float* m_pfCurrFrameData = nullptr;
     float* m_pfNextFrameData = nullptr;
-    std::unique_ptr<Renderer::ThermalVolume> m_pThermalTex;
+    HalfFloat* m_puiCurrFrameHalf = nullptr;
+    HalfFloat* m_puiNextFrameHalf = nullptr;
+    ThermalStorage m_eThermalStorage = ThermalStorage::FP32;
+    // Coarse fields (always FP32) while m_iThermalLod > 0; the fine buffer is then a prolonged copy
+    std::vector<float> m_vecCoarseCurr;
+    std::vector<float> m_vecCoarseNext;
+    int m_iThermalLod = 0;
+    // Renderer-side copies of the field: the texture pass reads the front slot while the owning
+    // worker writes the back one during an asynchronous update
+    std::vector<float> m_arrSnapshots[2];
+    int m_iSnapshotFront = 0;
+    bool m_bSnapshotPending = false;
+    bool m_bThermalUpdateInFlight = false;  // Live fields owned by the thermal workers
+    Renderer::ThermalAtlas* m_pThermalAtlas = nullptr;
+    int m_iThermalSlot = -1;
+    bool m_bThermalSlotFilled = false;  // The slot holds this chunk's field on the GPU
+    uint64_t m_uiSlotFillSerial = 0;    // Upload ring frame of the slot's first upload
+    float m_fLastMaxDelta = 0.0f;
+    bool m_bThermalActive = false;
+    uint64_t m_uiThermalGeneration = 1;
+    uint64_t m_uiUploadedGeneration = 0;
+    uint64_t m_uiLodRecheckEpoch = 0;
 
     // Per-chunk noise instance (Consider moving to a global generator for efficiency)
     FastNoiseLite noise{};
     int m_iHeightData[CHUNK_SIZE][CHUNK_SIZE];
     int m_iChunkX = 0, m_iChunkZ = 0;
     uint8_t m_iBlocks[CHUNK_VOL]{0};
+    // Lowest and highest layer holding a solid block (min > max while the chunk is all air)
+    int m_iMinSolidY = CHUNK_HEIGHT;
+    int m_iMaxSolidY = -1;
+    uint8_t m_arrOccluderHeights[OCCLUDER_CELLS][OCCLUDER_CELLS]{};
     bool m_bVonNeumannBC = true;
 
+    void allocateThermalBuffers();
+    void releaseThermalBuffers();
+    void releaseThermalSlot();
+
+    // Cell access in either storage; the caller checks HasThermalData()
+    float loadCell(int iPaddedIndex) const {
+        return m_pfCurrFrameData ? m_pfCurrFrameData[iPaddedIndex]
+                                 : ThermalKernels::HalfToFloat(m_puiCurrFrameHalf[iPaddedIndex]);
+    }
+    void storeCell(int iPaddedIndex, float fValue) {
+        if (m_pfCurrFrameData)
+            m_pfCurrFrameData[iPaddedIndex] = fValue;
+        else
+            m_puiCurrFrameHalf[iPaddedIndex] = ThermalKernels::FloatToHalf(fValue);
+    }
+
+    // Current field of storage type T (float or HalfFloat), nullptr if stored as the other one
+    template <typename T>
+    T* getCurrField() const;
+    template <typename T>
+    void fillHalo();
+    template <typename T>
+    void gatherTile(float* pfTile,
+                    uint8_t* puiPinned,
+                    int iGhost,
+                    int iTileX,
+                    int iTileY,
+                    int iTileZ) const;
+
+    // LOD: mean of the current field over a box in full-resolution cell coordinates (aligned to
+    // this chunk's cells or inside one of them), and the halo value across a face between chunks
+    // of different resolution
+    float meanOverRegion(const int arrOrigin[3], const int arrSize[3]) const;
+    float interfaceGhost(Direction iDir, int iCX, int iCY, int iCZ, float fOwn) const;
+    void fillCoarseHalo();
+    void fillLodInterfaceHalo();
+    void stepCoarse(float fCoefficient, bool bUseSIMD);
     void updateHeightData();
-    void updateBuffers();
-    void addBlockFace(int iX, int iY, int iZ, FaceDirection iDir, int iBlockType);
+    void updateSolidRange();
+    void updateOccluderCell(int iCellX, int iCellZ);
+    bool updateBuffers(Renderer::GeometryArena& objArena);
+    void releaseMeshRange();
 };
\ No newline at end of file
@@ -0,0 +1,90 @@
+/**
+ * @file ChunkBoundsTable.h
+ * @brief Defines the ChunkBoundsTable class, the loaded chunks' bounding boxes kept as a structure
+ * of arrays for batch frustum culling.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "../renderer/Frustum.h"
+#include "Chunk.h"
+
+/**
+ * @class ChunkBoundsTable
+ * @brief One entry per loaded chunk: its Chunk::GetAABB() split over six float arrays plus the
+ * chunk pointer at the same index. ChunkManager refreshes an entry on load and after every edit
+ * and drops it on unload, so the renderer culls without touching the chunks.
+ *
+ * Entries are packed: removing one moves the last entry into its place, so indices are only
+ * valid until the next Remove().
+ */
+class ChunkBoundsTable {
+public:
+    /**
+     * @brief Adds the chunk, or refreshes its box (and pointer) if its coordinates are listed.
+     */
+    void Set(Chunk& objChunk) {
+        const std::pair<int, int> Coords = {objChunk.GetChunkX(), objChunk.GetChunkZ()};
+        const auto [itrEntry, bInserted] = m_mapIndices.try_emplace(Coords, m_vecChunks.size());
+        if (bInserted) {
+            m_vecChunks.push_back(nullptr);
+            for (std::vector<float>* pvecBounds : getArrays()) pvecBounds->push_back(0.0f);
+        }
+        const size_t iIndex = itrEntry->second;
+        const AABB objBox = objChunk.GetAABB();
+        m_vecChunks[iIndex] = &objChunk;
+        m_vecMinX[iIndex] = objBox.m_objMinPt.x;
+        m_vecMinY[iIndex] = objBox.m_objMinPt.y;
+        m_vecMinZ[iIndex] = objBox.m_objMinPt.z;
+        m_vecMaxX[iIndex] = objBox.m_objMaxPt.x;
+        m_vecMaxY[iIndex] = objBox.m_objMaxPt.y;
+        m_vecMaxZ[iIndex] = objBox.m_objMaxPt.z;
+    }
+
+    void Remove(int iChunkX, int iChunkZ) {
+        auto itrEntry = m_mapIndices.find({iChunkX, iChunkZ});
+        if (itrEntry == m_mapIndices.end())
+            return;
+        const size_t iIndex = itrEntry->second;
+        const size_t iLast = m_vecChunks.size() - 1;
+        m_mapIndices.erase(itrEntry);
+        if (iIndex != iLast) {
+            const Chunk* pMoved = m_vecChunks[iLast];
+            m_mapIndices[{pMoved->GetChunkX(), pMoved->GetChunkZ()}] = iIndex;
+            m_vecChunks[iIndex] = m_vecChunks[iLast];
+            for (std::vector<float>* pvecBounds : getArrays())
+                (*pvecBounds)[iIndex] = (*pvecBounds)[iLast];
+        }
+        m_vecChunks.pop_back();
+        for (std::vector<float>* pvecBounds : getArrays()) pvecBounds->pop_back();
+    }
+
+    size_t GetCount() const { return m_vecChunks.size(); }
+    Chunk* GetChunk(size_t iIndex) const { return m_vecChunks[iIndex]; }
+
+    BoxArraySoA GetBoxes() const {
+        return {m_vecMinX.data(),
+                m_vecMinY.data(),
+                m_vecMinZ.data(),
+                m_vecMaxX.data(),
+                m_vecMaxY.data(),
+                m_vecMaxZ.data(),
+                m_vecChunks.size()};
+    }
+
+private:
+    std::vector<float> m_vecMinX, m_vecMinY, m_vecMinZ;
+    std::vector<float> m_vecMaxX, m_vecMaxY, m_vecMaxZ;
+    std::vector<Chunk*> m_vecChunks;
+    std::map<std::pair<int, int>, size_t> m_mapIndices;
+
+    std::array<std::vector<float>*, 6> getArrays() {
+        return {&m_vecMinX, &m_vecMinY, &m_vecMinZ, &m_vecMaxX, &m_vecMaxY, &m_vecMaxZ};
+    }
+};
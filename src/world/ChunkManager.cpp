@@ -4,10 +4,16 @@
  */
 
 #include "ChunkManager.h"
+#include <chrono>
+#include <cstddef>
 #include <iostream>
+#include <limits>
 
 //*********************************************************************
 void ChunkManager::Update(float fPlayerX, float fPlayerZ) {
+    m_fPlayerX = fPlayerX;
+    m_fPlayerZ = fPlayerZ;
+
     // 1. Process Finished Chunks from ThreadPool
     std::optional<Chunk> optChunk;
     while ((optChunk = m_objFinishedQueue.try_pop()).has_value()) {
@@ -18,11 +24,10 @@ void ChunkManager::Update(float fPlayerX, float fPlayerZ) {
         // Move into main map
         m_mapChunks[std::make_pair(iCX, iCZ)] = std::move(pNewChunk);
         Chunk* pActiveChunk = m_mapChunks[{iCX, iCZ}].get();
+        pActiveChunk->SetMeshLod(getMeshLod(iCX, iCZ, MESH_MAX_LOD));
+        m_objChunkBounds.Set(*pActiveChunk);
         updateChunkNeighbours(pActiveChunk);
-
-        // Generate mesh on Main Thread (OpenGL requires this)
-        pActiveChunk->ReconstructMesh(m_bEnableNeighborCulling);
-        pActiveChunk->UploadMesh();
+        requestRemesh(*pActiveChunk);
 
         // Remove from pending set
         {
@@ -31,19 +36,36 @@ void ChunkManager::Update(float fPlayerX, float fPlayerZ) {
         }
     }
 
-    // 2. Determine Current Chunk
+    // 2. Stream chunks in and out once the player enters another chunk (or the render distance
+    // changed), then move the mesh LOD rings along
     int iCurrentChunkX = static_cast<int>(std::floor(fPlayerX / CHUNK_SIZE));
     int iCurrentChunkZ = static_cast<int>(std::floor(fPlayerZ / CHUNK_SIZE));
-
-    if (iCurrentChunkX == m_iLastPlayerChunkX && iCurrentChunkZ == m_iLastPlayerChunkZ) {
-        updateGeneratedMeshStats();
-        return;
+    if (iCurrentChunkX != m_iLastPlayerChunkX || iCurrentChunkZ != m_iLastPlayerChunkZ ||
+        m_bStreamingStale) {
+        m_iLastPlayerChunkX = iCurrentChunkX;
+        m_iLastPlayerChunkZ = iCurrentChunkZ;
+        m_bStreamingStale = false;
+        m_bMeshLodsStale = true;
+        streamChunks(iCurrentChunkX, iCurrentChunkZ);
+    }
+    if (m_bMeshLodsStale) {
+        m_bMeshLodsStale = false;
+        updateMeshLods();
     }
 
-    m_iLastPlayerChunkX = iCurrentChunkX;
-    m_iLastPlayerChunkZ = iCurrentChunkZ;
+    // 3. Remesh every chunk dirtied since the last frame, once each
+    flushRemeshQueue();
 
-    // 3. Unload Far Chunks
+    // 4. Upload meshes finished by the thread pool (only the GL part runs here), within the
+    // frame's budget, after the ones the full arena refused if space has been freed since
+    retryRefusedMeshes();
+    uploadFinishedMeshes();
+    updateGeneratedMeshStats();
+}
+
+//*********************************************************************
+void ChunkManager::streamChunks(int iCurrentChunkX, int iCurrentChunkZ) {
+    // Unload Far Chunks
     for (auto itr = m_mapChunks.begin(); itr != m_mapChunks.end();) {
         int iChunkX = itr->first.first;
         int iChunkZ = itr->first.second;
@@ -52,13 +74,15 @@ void ChunkManager::Update(float fPlayerX, float fPlayerZ) {
             std::abs(iChunkZ - iCurrentChunkZ) > m_iRenderDistance + 2) {
             // Save before unloading (Optional, adds lag spike)
             // m_objRegionManager.SaveChunk(*itr->second);
+            m_mapMeshTickets.erase(itr->first);
+            m_objChunkBounds.Remove(iChunkX, iChunkZ);
             itr = m_mapChunks.erase(itr);
         } else {
             ++itr;
         }
     }
 
-    // 4. Queue New Chunks
+    // Queue New Chunks
     for (int iX = iCurrentChunkX - m_iRenderDistance; iX <= iCurrentChunkX + m_iRenderDistance;
          iX++) {
         for (int iZ = iCurrentChunkZ - m_iRenderDistance; iZ <= iCurrentChunkZ + m_iRenderDistance;
@@ -82,42 +106,252 @@ void ChunkManager::Update(float fPlayerX, float fPlayerZ) {
 
                 m_mapChunks[ChunkCoord] = std::move(pNewChunk);
                 Chunk* pActiveChunk = m_mapChunks[ChunkCoord].get();
+                pActiveChunk->SetMeshLod(getMeshLod(iX, iZ, MESH_MAX_LOD));
+                m_objChunkBounds.Set(*pActiveChunk);
                 updateChunkNeighbours(pActiveChunk);
-                if (pActiveChunk) {
-                    pActiveChunk->ReconstructMesh(m_bEnableNeighborCulling);
-                    pActiveChunk->UploadMesh();
-                }
+                requestRemesh(*pActiveChunk);
 
             } else {  // ASynchronous Mode
                 enqueueLoadChunk(iX, iZ);
             }
         }
     }
-    updateGeneratedMeshStats();
+}
+
+//*********************************************************************
+int ChunkManager::getMeshLod(int iChunkX, int iChunkZ, int iCurrentLod) const {
+    if (!m_bIsMeshLodEnabled)
+        return 0;
+    // Level reached at iDistance: one more each time the radius doubles
+    auto LevelAt = [this](int iDistance) {
+        int iLod = 0;
+        for (int iLimit = m_iMeshLodRadius; iLod < MESH_MAX_LOD && iDistance > iLimit; iLimit *= 2)
+            ++iLod;
+        return iLod;
+    };
+    const int iDistance = std::max(std::abs(iChunkX - m_iLastPlayerChunkX),
+                                   std::abs(iChunkZ - m_iLastPlayerChunkZ));
+    // Coarsening is judged MESH_LOD_HYSTERESIS chunks nearer, refining at the real distance
+    return std::clamp(iCurrentLod,
+                      LevelAt(iDistance - MESH_LOD_HYSTERESIS),
+                      LevelAt(iDistance));
+}
+
+//*********************************************************************
+void ChunkManager::updateMeshLods() {
+    for (auto& [Coords, pChunk] : m_mapChunks) {
+        const int iLod = getMeshLod(Coords.first, Coords.second, pChunk->GetMeshLod());
+        if (iLod == pChunk->GetMeshLod())
+            continue;
+        pChunk->SetMeshLod(iLod);
+        m_objChunkBounds.Set(*pChunk);  // Coarser cells may round its box out
+        requestRemesh(*pChunk);
+        // Their border towards this chunk turns into matching cells or a skirt
+        for (int iDir = 0; iDir < 6; ++iDir) {
+            if (Chunk* pNeighbour = pChunk->GetNeighbour(static_cast<Direction>(iDir)))
+                requestRemesh(*pNeighbour);
+        }
+    }
+}
+
+//*********************************************************************
+void ChunkManager::requestRemesh(Chunk& objChunk) {
+    if (objChunk.MarkMeshDirty())
+        m_vecRemeshQueue.emplace_back(objChunk.GetChunkX(), objChunk.GetChunkZ());
+}
+
+//*********************************************************************
+void ChunkManager::flushRemeshQueue() {
+    for (const std::pair<int, int>& Coords : m_vecRemeshQueue) {
+        // Unloaded since it was queued, or a reloaded chunk that nothing dirtied yet
+        Chunk* pChunk = GetChunk(Coords.first, Coords.second);
+        if (!pChunk || !pChunk->IsMeshDirty())
+            continue;
+        pChunk->ClearMeshDirty();
+        rebuildMesh(*pChunk);
+    }
+    m_vecRemeshQueue.clear();
+}
+
+//*********************************************************************
+void ChunkManager::rebuildMesh(Chunk& objChunk) {
+    const std::pair<int, int> Coords = {objChunk.GetChunkX(), objChunk.GetChunkZ()};
+    if (m_iActiveThreads == 0) {  // Synchronous mode: any job still running is now stale
+        m_mapMeshTickets.erase(Coords);
+        auto tStart = std::chrono::steady_clock::now();
+        objChunk.ReconstructMesh(m_bEnableNeighborCulling, m_eMeshingMode);
+        auto tEnd = std::chrono::steady_clock::now();
+        m_dMeshingMs += std::chrono::duration<double, std::milli>(tEnd - tStart).count();
+        ++m_iNbMeshedChunks;
+        uploadMesh(objChunk);
+        return;
+    }
+
+    // The job only sees this snapshot, never the live chunk or its neighbours
+    auto pInput = std::make_shared<ChunkMeshInput>();
+    objChunk.TakeMeshInput(*pInput);
+    const uint64_t uiTicket = ++m_uiNextMeshTicket;
+    m_mapMeshTickets[Coords] = uiTicket;
+    ++m_iNbMeshJobsInFlight;
+
+    const bool bEnableNeighborCulling = m_bEnableNeighborCulling;
+    const MeshingMode eMode = m_eMeshingMode;
+    m_objThreadPool.submit([this, pInput, Coords, uiTicket, bEnableNeighborCulling, eMode]() {
+        MeshJobResult objResult;
+        objResult.m_Coords = Coords;
+        objResult.m_uiTicket = uiTicket;
+        auto tStart = std::chrono::steady_clock::now();
+        Chunk::BuildMesh(*pInput, bEnableNeighborCulling, eMode, objResult.m_objMesh);
+        auto tEnd = std::chrono::steady_clock::now();
+        objResult.m_dMeshingMs = std::chrono::duration<double, std::milli>(tEnd - tStart).count();
+        m_objMeshedQueue.push(std::move(objResult));
+    });
+}
+
+//*********************************************************************
+bool ChunkManager::isCurrentMeshJob(const MeshJobResult& objResult) const {
+    // Stale when the chunk was unloaded or remeshed again after this job was submitted
+    auto itrTicket = m_mapMeshTickets.find(objResult.m_Coords);
+    return itrTicket != m_mapMeshTickets.end() && itrTicket->second == objResult.m_uiTicket;
+}
+
+//*********************************************************************
+void ChunkManager::uploadFinishedMeshes() {
+    std::optional<MeshJobResult> optResult;
+    while ((optResult = m_objMeshedQueue.try_pop()).has_value()) {
+        --m_iNbMeshJobsInFlight;
+        m_vecPendingUploads.push_back(std::move(optResult.value()));
+    }
+    std::erase_if(m_vecPendingUploads,
+                  [this](const MeshJobResult& objResult) { return !isCurrentMeshJob(objResult); });
+
+    m_iLastFrameUploads = 0;
+    m_iLastFrameUploadBytes = 0;
+    if (m_vecPendingUploads.empty())
+        return;
+
+    // Visible chunks first, each group nearest first
+    const float fHalfChunk = 0.5f * static_cast<float>(CHUNK_SIZE);
+    const float fInvisiblePenalty = std::numeric_limits<float>::max() * 0.5f;
+    for (MeshJobResult& objResult : m_vecPendingUploads) {
+        const Chunk* pChunk = GetChunk(objResult.m_Coords.first, objResult.m_Coords.second);
+        const float fDX =
+            static_cast<float>(objResult.m_Coords.first * CHUNK_SIZE) + fHalfChunk - m_fPlayerX;
+        const float fDZ =
+            static_cast<float>(objResult.m_Coords.second * CHUNK_SIZE) + fHalfChunk - m_fPlayerZ;
+        objResult.m_fUploadPriority = fDX * fDX + fDZ * fDZ;
+        if (m_bHasUploadFrustum && !m_objUploadFrustum.IsBoxInVisibleFrustum(pChunk->GetAABB()))
+            objResult.m_fUploadPriority += fInvisiblePenalty;
+    }
+    std::sort(m_vecPendingUploads.begin(),
+              m_vecPendingUploads.end(),
+              [](const MeshJobResult& objA, const MeshJobResult& objB) {
+                  return objA.m_fUploadPriority < objB.m_fUploadPriority;
+              });
+
+    auto tStart = std::chrono::steady_clock::now();
+    size_t iNbUploaded = 0;
+    for (MeshJobResult& objResult : m_vecPendingUploads) {
+        if (iNbUploaded > 0) {
+            auto tNow = std::chrono::steady_clock::now();
+            const double dElapsedMs =
+                std::chrono::duration<double, std::milli>(tNow - tStart).count();
+            if (m_iLastFrameUploadBytes >= m_iUploadBudgetBytes || dElapsedMs >= m_dUploadBudgetMs)
+                break;
+        }
+        m_mapMeshTickets.erase(objResult.m_Coords);
+        Chunk* pChunk = GetChunk(objResult.m_Coords.first, objResult.m_Coords.second);
+        m_dMeshingMs += objResult.m_dMeshingMs;
+        ++m_iNbMeshedChunks;
+        pChunk->SetMesh(std::move(objResult.m_objMesh));
+        uploadMesh(*pChunk);
+        m_iLastFrameUploadBytes += pChunk->GetMeshByteSize();
+        ++iNbUploaded;
+    }
+    m_iLastFrameUploads = iNbUploaded;
+    m_vecPendingUploads.erase(
+        m_vecPendingUploads.begin(),
+        m_vecPendingUploads.begin() + static_cast<std::ptrdiff_t>(iNbUploaded));
+}
+
+//*********************************************************************
+void ChunkManager::uploadMesh(Chunk& objChunk) {
+    Renderer::GeometryArena& objArena = getGeometryArena();
+    const bool bListed = objChunk.HasRefusedMesh();  // An older mesh of it was refused already
+    if (!objChunk.UploadMesh(objArena)) {
+        if (!bListed)
+            m_vecRefusedMeshes.emplace_back(objChunk.GetChunkX(), objChunk.GetChunkZ());
+        m_uiRefusedAtUsedWords = objArena.GetUsedWords();
+    }
+    m_objChunkBounds.Set(objChunk);  // The box follows the uploaded mesh LOD
+}
+
+//*********************************************************************
+void ChunkManager::retryRefusedMeshes() {
+    Renderer::GeometryArena& objArena = getGeometryArena();
+    // Nothing freed since the last refusal: the arena would refuse them again
+    if (m_vecRefusedMeshes.empty() || objArena.GetUsedWords() >= m_uiRefusedAtUsedWords)
+        return;
+    std::erase_if(m_vecRefusedMeshes, [this, &objArena](const std::pair<int, int>& Coords) {
+        // Unloaded, or remeshed and uploaded since
+        Chunk* pChunk = GetChunk(Coords.first, Coords.second);
+        if (!pChunk || !pChunk->HasRefusedMesh())
+            return true;
+        const bool bUploaded = pChunk->UploadMesh(objArena);
+        m_objChunkBounds.Set(*pChunk);
+        return bUploaded;
+    });
+    m_uiRefusedAtUsedWords = objArena.GetUsedWords();
+}
+
+//*********************************************************************
+Renderer::GeometryArena& ChunkManager::getGeometryArena() {
+    if (!m_pGeometryArena)
+        m_pGeometryArena = std::make_unique<Renderer::GeometryArena>(GEOMETRY_ARENA_INITIAL_WORDS);
+    return *m_pGeometryArena;
+}
+
+//*********************************************************************
+MeshingStats ChunkManager::MeasureMeshing(MeshingMode eMode) {
+    MeshingStats objStats;
+    ChunkMeshInput objInput;
+    ChunkMesh objMesh;
+    auto tStart = std::chrono::steady_clock::now();
+    for (auto& [coords, pChunk] : m_mapChunks) {
+        pChunk->TakeMeshInput(objInput);
+        Chunk::BuildMesh(objInput, m_bEnableNeighborCulling, eMode, objMesh);
+        objStats.m_iNbVertices += objMesh.m_vecFaces.size() * 4;
+        objStats.m_iNbTriangles += objMesh.m_vecFaces.size() * 2;
+    }
+    auto tEnd = std::chrono::steady_clock::now();
+    objStats.m_dMeshingMs = std::chrono::duration<double, std::milli>(tEnd - tStart).count();
+    return objStats;
 }
 
 //*********************************************************************
 void ChunkManager::updateGeneratedMeshStats() {
     m_iGeneratedVertexCount = 0;
     m_iGeneratedTriangleCount = 0;
+    m_iGeneratedMeshBytes = 0;
+    std::fill(std::begin(m_arrNbMeshLodChunks), std::end(m_arrNbMeshLodChunks), 0);
     for (const auto& [coords, pChunk] : m_mapChunks) {
         if (!pChunk)
             continue;
+        ++m_arrNbMeshLodChunks[pChunk->GetUploadedMeshLod()];
         size_t iNbVertices = 0, iNbTriangles = 0;
         pChunk->GetMeshStats(iNbVertices, iNbTriangles);
         m_iGeneratedVertexCount += iNbVertices;
         m_iGeneratedTriangleCount += iNbTriangles;
+        m_iGeneratedMeshBytes += pChunk->GetMeshByteSize();
     }
 }
 //*********************************************************************
 void ChunkManager::ReloadAllChunks() {
     for (auto& [coords, pChunk] : m_mapChunks) {
         if (pChunk) {
-            pChunk->ReconstructMesh(m_bEnableNeighborCulling);
-            pChunk->UploadMesh();
+            requestRemesh(*pChunk);
         }
     }
-    updateGeneratedMeshStats();
 }
 //*********************************************************************
 void ChunkManager::SetBlock(int iWorldX, int iWorldY, int iWorldZ, uint8_t iBlockType) {
@@ -140,8 +374,6 @@ void ChunkManager::SetBlock(int iWorldX, int iWorldY, int iWorldZ, uint8_t iBloc
         iLocalZ += CHUNK_SIZE;
 
     pChunk->SetBlockAt(iLocalX, iWorldY, iLocalZ, iBlockType);
-    pChunk->ReconstructMesh(m_bEnableNeighborCulling);
-    pChunk->UploadMesh();
 
     // Logic: If placing a block, convert grass below to dirt
     if (iBlockType != 0 && iWorldY > 0) {
@@ -151,32 +383,31 @@ void ChunkManager::SetBlock(int iWorldX, int iWorldY, int iWorldZ, uint8_t iBloc
         }
     }
 
+    // Remeshed at the next Update(), after every edit of this frame
+    m_objChunkBounds.Set(*pChunk);
+    requestRemesh(*pChunk);
+
     // Update Neighbors if on boundary
     if (iLocalX == 0) {
         if (Chunk* pWest = GetChunk(iChunkX - 1, iChunkZ)) {
-            pWest->ReconstructMesh(m_bEnableNeighborCulling);
-            pWest->UploadMesh();
+            requestRemesh(*pWest);
         }
     }
     if (iLocalX == CHUNK_SIZE - 1) {
         if (Chunk* pEast = GetChunk(iChunkX + 1, iChunkZ)) {
-            pEast->ReconstructMesh(m_bEnableNeighborCulling);
-            pEast->UploadMesh();
+            requestRemesh(*pEast);
         }
     }
     if (iLocalZ == 0) {
         if (Chunk* pSouth = GetChunk(iChunkX, iChunkZ - 1)) {
-            pSouth->ReconstructMesh(m_bEnableNeighborCulling);
-            pSouth->UploadMesh();
+            requestRemesh(*pSouth);
         }
     }
     if (iLocalZ == CHUNK_SIZE - 1) {
         if (Chunk* pNorth = GetChunk(iChunkX, iChunkZ + 1)) {
-            pNorth->ReconstructMesh(m_bEnableNeighborCulling);
-            pNorth->UploadMesh();
+            requestRemesh(*pNorth);
         }
     }
-    updateGeneratedMeshStats();
 }
 
 //*********************************************************************
@@ -240,9 +471,8 @@ void ChunkManager::updateChunkNeighbours(Chunk* pChunk) {
 
             pNeighbor->SetNeighbours(iOppDir, pChunk);
 
-            // Trigger neighbor update
-            pNeighbor->ReconstructMesh(m_bEnableNeighborCulling);
-            pNeighbor->UploadMesh();
+            // Its border changed: remesh it once this frame, however many chunks arrive around it
+            requestRemesh(*pNeighbor);
         }
     };
 
@@ -8,6 +8,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -15,16 +16,29 @@
 #include <optional>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "../core/ThreadPool.h"
 #include "../core/ThreadSafeQueue.h"
+#include "../renderer/Frustum.h"
 #include "Chunk.h"
+#include "ChunkBoundsTable.h"
 #include "RegionManager.h"
 
 namespace Renderer {
 class Shader;
 }
 
+/**
+ * @struct MeshingStats
+ * @brief Mesh size and CPU meshing time of every loaded chunk for one mesher.
+ */
+struct MeshingStats {
+    size_t m_iNbVertices{0};
+    size_t m_iNbTriangles{0};
+    double m_dMeshingMs{0.0};
+};
+
 /**
  * @class ChunkManager
  * @brief Orchestrates infinite world generation, active chunk tracking, and multi-threaded data
@@ -32,6 +46,13 @@ class Shader;
  */
 class ChunkManager {
 public:
+    static constexpr size_t DEFAULT_UPLOAD_BUDGET_BYTES = 512 * 1024;
+    static constexpr double DEFAULT_UPLOAD_BUDGET_MS = 2.0;
+    // 4 MB of faces to start with (a few hundred greedy chunks), doubled on demand
+    static constexpr unsigned int GEOMETRY_ARENA_INITIAL_WORDS = 1u << 20;
+    // Chunks a mesh LOD threshold must be passed by before a chunk coarsens
+    static constexpr int MESH_LOD_HYSTERESIS = 1;
+
     ChunkManager() = delete;
     ChunkManager(std::string& strFolderPath) : m_objRegionManager(strFolderPath) {}
 
@@ -43,10 +64,48 @@ public:
      */
     void Update(float fPlayerX, float fPlayerZ);
 
+    /**
+     * @brief Chunks loaded around the player along X and Z (Chebyshev distance), streamed in and
+     * out from the next Update() on.
+     */
+    void SetRenderDistance(int iChunks) {
+        iChunks = std::max(iChunks, 1);
+        m_bStreamingStale |= iChunks != m_iRenderDistance;
+        m_iRenderDistance = iChunks;
+    }
+    int GetRenderDistance() const { return m_iRenderDistance; }
+
+    /**
+     * @brief Mesh LOD: chunks within iRadius chunks (Chebyshev distance) of the player are meshed
+     * at full resolution, up to twice that with 2x coarser cells, four times with 4x and beyond
+     * with 8x. A chunk refines as soon as it is back within a threshold but only coarsens once it
+     * is MESH_LOD_HYSTERESIS chunks past it, so walking along a threshold does not remesh.
+     * Applied at the next Update().
+     */
+    void SetEnableMeshLod(bool bEnable) {
+        m_bMeshLodsStale |= bEnable != m_bIsMeshLodEnabled;
+        m_bIsMeshLodEnabled = bEnable;
+    }
+    bool IsMeshLodEnabled() const { return m_bIsMeshLodEnabled; }
+    void SetMeshLodRadius(int iRadius) {
+        iRadius = std::max(iRadius, 1);
+        m_bMeshLodsStale |= iRadius != m_iMeshLodRadius;
+        m_iMeshLodRadius = iRadius;
+    }
+    int GetMeshLodRadius() const { return m_iMeshLodRadius; }
+    /**
+     * @brief Loaded chunks whose uploaded mesh is at level iLod (see SetMeshLodRadius).
+     */
+    size_t GetMeshLodChunkCount(int iLod) const { return m_arrNbMeshLodChunks[iLod]; }
+
+    /**
+     * @brief Queues every loaded chunk for remeshing at the next Update().
+     */
     void ReloadAllChunks();
 
     /**
      * @brief Modifies a voxel block and invalidates necessary chunk meshes (including boundaries).
+     * The meshes are rebuilt at the next Update().
      */
     void SetBlock(int iWorldX, int iWorldY, int iWorldZ, uint8_t iBlockType);
 
@@ -68,11 +127,17 @@ public:
     const std::map<std::pair<int, int>, std::unique_ptr<Chunk>>& GetChunks() const {
         return m_mapChunks;
     }
+
+    /**
+     * @brief Bounding box of every loaded chunk, current after loads, unloads and SetBlock().
+     */
+    const ChunkBoundsTable& GetChunkBounds() const { return m_objChunkBounds; }
     void SetActiveThreads(int iCt) { m_iActiveThreads = iCt; }
     int GetActiveThreads() { return m_iActiveThreads; }
 
     size_t GetGeneratedVertCount() const { return m_iGeneratedVertexCount; }
     size_t GetGeneratedTriaCount() const { return m_iGeneratedTriangleCount; }
+    size_t GetGeneratedMeshBytes() const { return m_iGeneratedMeshBytes; }
 
     void AddToUploadedVertCount(size_t iCt) { m_iUploadedVertexCount += iCt; }
     void ResetUploadedVertCount() { m_iUploadedVertexCount = 0; }
@@ -85,29 +150,154 @@ public:
     void SetNeighborCulling(bool bNeighborCulling) { m_bEnableNeighborCulling = bNeighborCulling; }
     bool GetNeighborCulling() const { return m_bEnableNeighborCulling; }
 
+    /**
+     * @brief Mesher used from the next rebuild on (ReloadAllChunks() applies it everywhere).
+     */
+    void SetMeshingMode(MeshingMode eMode) { m_eMeshingMode = eMode; }
+    MeshingMode GetMeshingMode() const { return m_eMeshingMode; }
+
+    /**
+     * @brief Meshes every loaded chunk on the CPU with eMode (current culling setting) and
+     * reports the total size and time. The meshes are discarded: nothing changes on screen.
+     */
+    MeshingStats MeasureMeshing(MeshingMode eMode);
+
+    /**
+     * @brief Average ReconstructMesh() time over all chunks meshed since the last reset.
+     */
+    double GetAverageMeshingMs() const {
+        return m_iNbMeshedChunks ? m_dMeshingMs / static_cast<double>(m_iNbMeshedChunks) : 0.0;
+    }
+    void ResetMeshingTime() {
+        m_dMeshingMs = 0.0;
+        m_iNbMeshedChunks = 0;
+    }
+    /**
+     * @brief Meshes applied since the last ResetMeshingTime().
+     */
+    size_t GetMeshedChunkCount() const { return m_iNbMeshedChunks; }
+
+    /**
+     * @brief Meshing jobs submitted to the thread pool whose result Update() has not collected.
+     */
+    size_t GetPendingMeshCount() const { return m_iNbMeshJobsInFlight; }
+
+    /**
+     * @brief Per-frame budget for the GL uploads of finished meshes: Update() stops uploading
+     * once either is spent (after at least one mesh, so the backlog always drains). The rest
+     * waits, visible chunks first, then nearest to the player.
+     */
+    void SetUploadBudget(size_t iBytesPerFrame, double dMsPerFrame) {
+        m_iUploadBudgetBytes = iBytesPerFrame;
+        m_dUploadBudgetMs = dMsPerFrame;
+    }
+    /**
+     * @brief Camera frustum ranking the pending uploads (the last frame's is good enough).
+     */
+    void SetUploadFrustum(const Core::Mat4& objViewProjection) {
+        m_objUploadFrustum.Update(objViewProjection);
+        m_bHasUploadFrustum = true;
+    }
+    size_t GetPendingUploadCount() const { return m_vecPendingUploads.size(); }
+    size_t GetLastFrameUploadCount() const { return m_iLastFrameUploads; }
+    size_t GetLastFrameUploadBytes() const { return m_iLastFrameUploadBytes; }
+
+    /**
+     * @brief Storage buffer holding the faces of every uploaded chunk mesh, created by the first
+     * upload (nullptr before).
+     */
+    const Renderer::GeometryArena* GetGeometryArena() const { return m_pGeometryArena.get(); }
+
 private:
+    void streamChunks(int iCurrentChunkX, int iCurrentChunkZ);
     void enqueueLoadChunk(int iX, int iZ);
     void updateChunkNeighbours(Chunk* pChunk);
+    // Mesh LOD of a chunk around the current player chunk, with hysteresis from iCurrentLod
+    // (MESH_MAX_LOD for chunks without a mesh yet: the coarsest level their distance allows)
+    int getMeshLod(int iChunkX, int iChunkZ, int iCurrentLod) const;
+    // Applies getMeshLod() to every loaded chunk, remeshing the changed ones and their neighbours
+    void updateMeshLods();
     void updateGeneratedMeshStats();
+    // Deduplicated remesh queue: a chunk is queued when it turns dirty and remeshed once per
+    // frame by flushRemeshQueue(), however many edits or neighbour links dirtied it
+    void requestRemesh(Chunk& objChunk);
+    void flushRemeshQueue();
+    // Remeshes with the current culling and meshing mode: on the thread pool (uploaded by a
+    // later Update()) unless the manager runs synchronously (m_iActiveThreads == 0)
+    void rebuildMesh(Chunk& objChunk);
+    void uploadFinishedMeshes();
+    // Writes the chunk's mesh into the arena; a refused mesh is remembered for retryRefusedMeshes()
+    void uploadMesh(Chunk& objChunk);
+    // Uploads the meshes the full arena refused again, once ranges have been freed since
+    void retryRefusedMeshes();
 
+    /**
+     * @struct MeshJobResult
+     * @brief What a meshing job hands back to the main thread. The ticket tells whether the chunk
+     * was remeshed (or unloaded) again while the job ran.
+     */
+    struct MeshJobResult {
+        std::pair<int, int> m_Coords;
+        uint64_t m_uiTicket{0};
+        ChunkMesh m_objMesh;
+        double m_dMeshingMs{0.0};
+        float m_fUploadPriority{0.0f};  // Lower uploads first
+    };
+    bool isCurrentMeshJob(const MeshJobResult& objResult) const;
+    Renderer::GeometryArena& getGeometryArena();
+
+    // Declared before the chunks, which free their ranges into it when destroyed
+    std::unique_ptr<Renderer::GeometryArena> m_pGeometryArena;
     std::map<std::pair<int, int>, std::unique_ptr<Chunk>> m_mapChunks;
+    ChunkBoundsTable m_objChunkBounds;
 
     std::set<std::pair<int, int>> m_setPendingCoords;
     std::mutex m_mutexPending;
 
     RegionManager m_objRegionManager;
 
-    // ThreadPool must be destroyed BEFORE the queue to avoid use-after-free
+    std::vector<std::pair<int, int>> m_vecRemeshQueue;
+
+    // Latest meshing job per chunk (main thread only); older results are dropped
+    std::map<std::pair<int, int>, uint64_t> m_mapMeshTickets;
+    uint64_t m_uiNextMeshTicket = 0;
+    size_t m_iNbMeshJobsInFlight = 0;
+
+    // Finished meshes waiting for their GL upload
+    std::vector<MeshJobResult> m_vecPendingUploads;
+    size_t m_iUploadBudgetBytes = DEFAULT_UPLOAD_BUDGET_BYTES;
+    double m_dUploadBudgetMs = DEFAULT_UPLOAD_BUDGET_MS;
+    Frustum m_objUploadFrustum;
+    bool m_bHasUploadFrustum = false;
+    size_t m_iLastFrameUploads = 0;
+    size_t m_iLastFrameUploadBytes = 0;
+    // Chunks whose mesh the arena refused, and its used words after the last refusal
+    std::vector<std::pair<int, int>> m_vecRefusedMeshes;
+    unsigned int m_uiRefusedAtUsedWords = 0;
+
+    // ThreadPool must be destroyed BEFORE the queues to avoid use-after-free
     Core::ThreadSafeQueue<Chunk> m_objFinishedQueue;
+    Core::ThreadSafeQueue<MeshJobResult> m_objMeshedQueue;
     Core::ThreadPool m_objThreadPool;
 
     int m_iRenderDistance = 6;
+    bool m_bStreamingStale = false;
+    bool m_bIsMeshLodEnabled = false;
+    int m_iMeshLodRadius = 4;
+    bool m_bMeshLodsStale = false;
+    size_t m_arrNbMeshLodChunks[MESH_MAX_LOD + 1] = {};
     int m_iLastPlayerChunkX = -999999;
     int m_iLastPlayerChunkZ = -999999;
+    float m_fPlayerX = 0.0f;
+    float m_fPlayerZ = 0.0f;
     int m_iActiveThreads = 4;
     size_t m_iGeneratedVertexCount = 0;
     size_t m_iGeneratedTriangleCount = 0;
+    size_t m_iGeneratedMeshBytes = 0;
     size_t m_iUploadedVertexCount = 0;
     size_t m_iUploadedTriangleCount = 0;
     bool m_bEnableNeighborCulling = true;
+    MeshingMode m_eMeshingMode = MeshingMode::NAIVE;
+    double m_dMeshingMs = 0.0;
+    size_t m_iNbMeshedChunks = 0;
 };
\ No newline at end of file
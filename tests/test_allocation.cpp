@@ -0,0 +1,76 @@
+/**
+ * @file test_allocation.cpp
+ * @brief Google Test suite checking that steady-state remeshing makes no heap allocation. It
+ * replaces the global operator new, so it is built as its own test executable.
+ */
+
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <new>
+#include "../src/renderer/GeometryArena.h"
+#include "../src/world/Chunk.h"
+
+// Allocation-counting hook: counts operator new calls made by this thread while enabled
+namespace {
+thread_local bool t_bCountAllocations = false;
+thread_local size_t t_iNbAllocations = 0;
+
+void* countedAlloc(std::size_t iSize) {
+    if (t_bCountAllocations)
+        ++t_iNbAllocations;
+    return std::malloc(iSize ? iSize : 1);
+}
+}  // namespace
+
+void* operator new(std::size_t iSize) {
+    if (void* pData = countedAlloc(iSize))
+        return pData;
+    throw std::bad_alloc();
+}
+void* operator new[](std::size_t iSize) {
+    if (void* pData = countedAlloc(iSize))
+        return pData;
+    throw std::bad_alloc();
+}
+void* operator new(std::size_t iSize, const std::nothrow_t&) noexcept {
+    return countedAlloc(iSize);
+}
+void* operator new[](std::size_t iSize, const std::nothrow_t&) noexcept {
+    return countedAlloc(iSize);
+}
+// GCC pairs free() with the inlined operator new it replaces, not with the malloc() behind it
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void operator delete(void* pData) noexcept { std::free(pData); }
+void operator delete[](void* pData) noexcept { std::free(pData); }
+void operator delete(void* pData, std::size_t) noexcept { std::free(pData); }
+void operator delete[](void* pData, std::size_t) noexcept { std::free(pData); }
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+TEST(ChunkMeshTest, SteadyStateRemeshDoesNotAllocate) {
+    for (MeshingMode eMode : {MeshingMode::NAIVE, MeshingMode::GREEDY}) {
+        Renderer::GeometryArena objArena(1u << 16);
+        Chunk objChunk(3, -2);
+        auto RemeshWithBlock = [&](uint8_t uiBlockType) {
+            objChunk.SetBlockAt(5, CHUNK_HEIGHT - 1, 7, uiBlockType);
+            objChunk.ReconstructMesh(true, eMode);
+            objChunk.UploadMesh(objArena);
+        };
+        // Warm up: scratch arenas, mesh vectors and arena ranges sized for both meshes
+        RemeshWithBlock(STONE);
+        RemeshWithBlock(AIR);
+        const size_t iMeshBytes = objChunk.GetMeshByteSize();
+
+        t_iNbAllocations = 0;
+        t_bCountAllocations = true;
+        for (int iEdit = 0; iEdit < 8; ++iEdit) RemeshWithBlock(iEdit % 2 ? AIR : STONE);
+        t_bCountAllocations = false;
+
+        EXPECT_EQ(t_iNbAllocations, 0u) << "Mode: " << static_cast<int>(eMode);
+        EXPECT_EQ(objChunk.GetMeshByteSize(), iMeshBytes);
+    }
+}
@@ -1,11 +1,109 @@
 /**
  * @file ChunkTest.cpp
- * @brief Google Test suite for the Chunk class, verifying memory ownership, move semantics, and
- * thermal diffusion boundaries.
+ * @brief Google Test suite for the Chunk class, verifying memory ownership, move semantics,
+ * thermal diffusion boundaries and the naive / greedy meshers.
  */
 
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <array>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <set>
+#include <thread>
+#include <utility>
+#include "../src/renderer/DrawListSorter.h"
+#include "../src/renderer/OcclusionBuffer.h"
 #include "../src/world/Chunk.h"
+#include "../src/world/ChunkManager.h"
+
+namespace {
+
+/**
+ * @brief Expanded corners of a packed face, as the vertex shader pulls them.
+ */
+void FaceCorners(ChunkFace uiFace, int arrCorners[4][3]) {
+    for (int iCorner = 0; iCorner < 4; ++iCorner)
+        GetChunkFaceCorner(uiFace, iCorner, arrCorners[iCorner]);
+}
+
+/**
+ * @brief Mesh area per (face normal, atlas tile), checking on the way that the winding of every
+ * quad points to its FaceDirection.
+ */
+std::map<std::pair<int, int>, double> SurfaceByNormalAndTile(const Chunk& objChunk) {
+    // FaceDirection to normal index (axis * 2, + 1 when pointing down the axis)
+    const int arrFaceNormal[6] = {4, 5, 1, 0, 2, 3};
+    std::map<std::pair<int, int>, double> mapArea;
+    for (ChunkFace uiFace : objChunk.GetMeshFaces()) {
+        int arrCorners[4][3];
+        FaceCorners(uiFace, arrCorners);
+        int arrE1[3], arrE2[3];
+        for (int i = 0; i < 3; ++i) {
+            arrE1[i] = arrCorners[1][i] - arrCorners[0][i];
+            arrE2[i] = arrCorners[3][i] - arrCorners[0][i];
+        }
+        const int arrCross[3] = {arrE1[1] * arrE2[2] - arrE1[2] * arrE2[1],
+                                 arrE1[2] * arrE2[0] - arrE1[0] * arrE2[2],
+                                 arrE1[0] * arrE2[1] - arrE1[1] * arrE2[0]};
+        int iNormal = 0;
+        for (int i = 0; i < 3; ++i) {
+            if (arrCross[i] != 0)
+                iNormal = i * 2 + (arrCross[i] > 0 ? 0 : 1);
+        }
+        const double dArea = std::abs(arrCross[0] + arrCross[1] + arrCross[2]);
+
+        EXPECT_EQ(arrFaceNormal[UnpackFaceDirection(uiFace)], iNormal);
+        mapArea[{iNormal, UnpackFaceTile(uiFace)}] += dArea;
+    }
+    return mapArea;
+}
+
+/**
+ * @brief Every block face covered by the mesh, as (local X, Y, Z, outward Direction). Merged quads
+ * expand to one entry per covered block.
+ */
+std::multiset<std::array<int, 4>> MeshedFaces(const Chunk& objChunk) {
+    std::multiset<std::array<int, 4>> setFaces;
+    // Outward normal (axis, sign) to Direction
+    const int arrDirection[3][2] = {{EAST, WEST}, {ABOVE, BELOW}, {NORTH, SOUTH}};
+    for (ChunkFace uiFace : objChunk.GetMeshFaces()) {
+        int arrCorners[4][3];
+        FaceCorners(uiFace, arrCorners);
+        int arrMin[3] = {CHUNK_SIZE, CHUNK_HEIGHT, CHUNK_SIZE}, arrMax[3] = {0, 0, 0};
+        for (int iCorner = 0; iCorner < 4; ++iCorner) {
+            for (int i = 0; i < 3; ++i) {
+                arrMin[i] = std::min(arrMin[i], arrCorners[iCorner][i]);
+                arrMax[i] = std::max(arrMax[i], arrCorners[iCorner][i]);
+            }
+        }
+        // The quad's corners wind counter-clockwise around the outward normal
+        int iAxis = 0;
+        while (arrMin[iAxis] != arrMax[iAxis]) ++iAxis;
+        const int iA1 = (iAxis + 1) % 3, iA2 = (iAxis + 2) % 3;
+        const int iNormal = (arrCorners[1][iA1] - arrCorners[0][iA1]) *
+                                (arrCorners[3][iA2] - arrCorners[0][iA2]) -
+                            (arrCorners[1][iA2] - arrCorners[0][iA2]) *
+                                (arrCorners[3][iA1] - arrCorners[0][iA1]);
+        const bool bPositive = iNormal > 0;
+
+        int arrCell[3];
+        arrCell[iAxis] = bPositive ? arrMin[iAxis] - 1 : arrMin[iAxis];
+        for (arrCell[iA1] = arrMin[iA1]; arrCell[iA1] < arrMax[iA1]; ++arrCell[iA1])
+            for (arrCell[iA2] = arrMin[iA2]; arrCell[iA2] < arrMax[iA2]; ++arrCell[iA2])
+                setFaces.insert({arrCell[0],
+                                 arrCell[1],
+                                 arrCell[2],
+                                 arrDirection[iAxis][bPositive ? 0 : 1]});
+    }
+    return setFaces;
+}
+
+}  // namespace
 
 // --- Configuration & Layout Tests ---
 
@@ -30,11 +128,12 @@ TEST(ChunkTest, BlockIndicesCalculation) {
 // --- Memory & Ownership Tests (The "HPC Core") ---
 
 TEST(ChunkTest, MoveConstructor_VAO_OwnershipTransfer) {
+    // Requires OpenGL Context (Provided by test_main.cpp)
+    Renderer::GeometryArena objArena(1u << 16);
     Chunk ObjSrcChunk(0, 0);
 
-    // Requires OpenGL Context (Provided by test_main.cpp)
     ObjSrcChunk.ReconstructMesh();
-    ObjSrcChunk.UploadMesh();
+    ObjSrcChunk.UploadMesh(objArena);
 
     ASSERT_TRUE(ObjSrcChunk.IsValid()) << "Setup failed: Source Chunk VAO not created";
 
@@ -48,17 +147,17 @@ TEST(ChunkTest, MoveConstructor_VAO_OwnershipTransfer) {
 
     // Requires OpenGL Context (Provided by test_main.cpp)
     ObjTgtChunk.ReconstructMesh();
-    ObjTgtChunk.UploadMesh();
+    ObjTgtChunk.UploadMesh(objArena);
 }
 
 TEST(ChunkTest, MoveConstructor_ThermalBufferTransfer) {
     Chunk ObjSrcChunk(0, 0);
+    EXPECT_EQ(ObjSrcChunk.GetCurrData(), nullptr);  // Buffers are allocated on first heat
 
+    ObjSrcChunk.InjectHeat(8, 8, 8, 99.0f);
     float* pOriginalBuffer = ObjSrcChunk.GetCurrData();
     ASSERT_NE(pOriginalBuffer, nullptr);
 
-    ObjSrcChunk.InjectHeat(8, 8, 8, 99.0f);
-
     Chunk ObjTgtChunk(std::move(ObjSrcChunk));
 
     EXPECT_EQ(ObjTgtChunk.GetCurrData(), pOriginalBuffer);
@@ -80,6 +179,8 @@ TEST(ChunkTest, MoveConstructor_ThermalDataIntegrity) {
 TEST(ChunkTest, MoveAssignment_CleanupAndReplace) {
     Chunk ObjTgtChunk(0, 0);
     Chunk ObjSrcChunk(1, 1);
+    ObjTgtChunk.InjectHeat(1, 1, 1, 10.0f);
+    ObjSrcChunk.InjectHeat(1, 1, 1, 20.0f);
 
     float* pSrcBuffer = ObjSrcChunk.GetCurrData();
 
@@ -105,10 +206,14 @@ TEST(ChunkThermalTest, BoundaryDiffusionZAxis) {
     chunkHot.InjectHeat(testX, testY, CHUNK_SIZE - 1, startTemp);
 
     EXPECT_FLOAT_EQ(chunkCold.GetTemperatureAt(testX, testY, 0), 0.0f);
+    // ThermalSystem wakes the neighbour once heat reaches the shared face
+    chunkCold.WakeThermal();
 
     // Stable diffusivity to satisfy Von Neumann stability criterion (C (alpha * deltime) < 1/6)
     float fDiffusivity = 1.0f;
     float fDeltaTime = 0.1f;
+    chunkHot.FillHalo();
+    chunkCold.FillHalo();
     chunkHot.ThermalStep(fDiffusivity, fDeltaTime);
     chunkCold.ThermalStep(fDiffusivity, fDeltaTime);
     chunkHot.SwapBuffers();
@@ -119,4 +224,776 @@ TEST(ChunkThermalTest, BoundaryDiffusionZAxis) {
     EXPECT_GT(fColdTemp, 0.0f) << "Heat failed to cross the Z-axis boundary!";
 
     std::cout << "[          ] Transferred Heat: " << fColdTemp << std::endl;
-}
\ No newline at end of file
+}
+
+TEST(ChunkThermalTest, HaloFillMatchesNeighbourFaces) {
+    Chunk chunkWest(0, 0);
+    Chunk chunkEast(1, 0);
+    chunkWest.SetNeighbours(Direction::EAST, &chunkEast);
+    chunkEast.SetNeighbours(Direction::WEST, &chunkWest);
+
+    chunkEast.InjectHeat(0, 3, 7, 250.0f);
+    chunkWest.InjectHeat(0, 3, 7, 40.0f);
+    chunkWest.FillHalo();
+
+    const float* pfData = chunkWest.GetCurrData();
+    // Linked face copies the neighbour, unlinked face mirrors our own boundary (Von Neumann)
+    EXPECT_FLOAT_EQ(pfData[chunkWest.GetPaddedIndexOf3DLayer(CHUNK_SIZE, 3, 7)], 250.0f);
+    EXPECT_FLOAT_EQ(pfData[chunkWest.GetPaddedIndexOf3DLayer(-1, 3, 7)], 40.0f);
+}
+
+TEST(ChunkThermalTest, SIMDMatchesScalarAndConservesHeat) {
+    Chunk chunkScalar(0, 0);
+    Chunk chunkSIMD(0, 0);
+    const int arrHotSpots[][3] = {{0, 0, 0}, {15, 7, 3}, {8, 15, 15}, {4, 9, 0}};
+    for (const auto& arrPt : arrHotSpots) {
+        chunkScalar.InjectHeat(arrPt[0], arrPt[1], arrPt[2], 1000.0f);
+        chunkSIMD.InjectHeat(arrPt[0], arrPt[1], arrPt[2], 1000.0f);
+    }
+
+    for (int iStep = 0; iStep < 10; ++iStep) {
+        chunkScalar.FillHalo();
+        chunkSIMD.FillHalo();
+        chunkScalar.ThermalStep(0.2f, 0.5f);
+        chunkSIMD.ThermalStep_SIMD(0.2f, 0.5f);
+        chunkScalar.SwapBuffers();
+        chunkSIMD.SwapBuffers();
+    }
+
+    double dTotalHeat = 0.0;
+    for (int iZ = 0; iZ < CHUNK_SIZE; ++iZ) {
+        for (int iY = 0; iY < CHUNK_HEIGHT; ++iY) {
+            for (int iX = 0; iX < CHUNK_SIZE; ++iX) {
+                float fScalar = chunkScalar.GetTemperatureAt(iX, iY, iZ);
+                EXPECT_NEAR(chunkSIMD.GetTemperatureAt(iX, iY, iZ), fScalar, 1e-3f);
+                dTotalHeat += fScalar;
+            }
+        }
+    }
+    // An isolated chunk with zero-flux boundaries must not gain or lose energy
+    EXPECT_NEAR(dTotalHeat, 4000.0, 0.5);
+}
+
+// --- Meshing Tests ---
+
+TEST(ChunkMeshTest, GreedyCoversTheSameSurfaceWithFewerQuads) {
+    for (bool bCulling : {false, true}) {
+        Chunk objChunk(3, -2);
+        objChunk.ReconstructMesh(bCulling, MeshingMode::NAIVE);
+        const size_t iNaiveFaces = objChunk.GetMeshFaces().size();
+        const auto mapNaive = SurfaceByNormalAndTile(objChunk);
+
+        objChunk.ReconstructMesh(bCulling, MeshingMode::GREEDY);
+        const size_t iGreedyFaces = objChunk.GetMeshFaces().size();
+
+        // Same faces, same textures, merged
+        EXPECT_EQ(SurfaceByNormalAndTile(objChunk), mapNaive) << "Culling: " << bCulling;
+        EXPECT_LT(iGreedyFaces, iNaiveFaces / 2) << "Culling: " << bCulling;
+    }
+}
+
+TEST(ChunkMeshTest, FlatSlabMergesIntoSixQuads) {
+    std::vector<uint8_t> vecBlocks(CHUNK_VOL, AIR);
+    for (int iZ = 0; iZ < CHUNK_SIZE; ++iZ)
+        for (int iY = 0; iY < 4; ++iY)
+            for (int iX = 0; iX < CHUNK_SIZE; ++iX)
+                vecBlocks[Chunk(0, 0).GetFlatIndexOf3DLayer(iX, iY, iZ)] = STONE;
+
+    Renderer::GeometryArena objArena(1u << 16);
+    Chunk objChunk(0, 0);
+    objChunk.SetBlockData(vecBlocks.data());
+    objChunk.ReconstructMesh(true, MeshingMode::NAIVE);
+    EXPECT_EQ(objChunk.GetMeshFaces().size(), 768u);
+
+    objChunk.ReconstructMesh(true, MeshingMode::GREEDY);
+    EXPECT_EQ(objChunk.GetMeshFaces().size(), 6u);
+
+    objChunk.UploadMesh(objArena);
+    size_t iNbVertices = 0, iNbTriangles = 0;
+    objChunk.GetMeshStats(iNbVertices, iNbTriangles);
+    EXPECT_EQ(iNbVertices, 24u);
+    EXPECT_EQ(iNbTriangles, 12u);
+    // One packed word per face, no per-chunk vertices or indices
+    EXPECT_EQ(objChunk.GetMeshByteSize(), 6u * sizeof(ChunkFace));
+}
+
+TEST(ChunkMeshTest, PackedFaceRoundTrip) {
+    const ChunkFace uiFace = PackChunkFace(CHUNK_SIZE - 1, 7, 0, CHUNK_SIZE, 1, DOWN, 255);
+    EXPECT_EQ(UnpackFaceOrigin(uiFace, 0), CHUNK_SIZE - 1);
+    EXPECT_EQ(UnpackFaceOrigin(uiFace, 1), 7);
+    EXPECT_EQ(UnpackFaceOrigin(uiFace, 2), 0);
+    EXPECT_EQ(UnpackFaceSizeU(uiFace), CHUNK_SIZE);
+    EXPECT_EQ(UnpackFaceSizeV(uiFace), 1);
+    EXPECT_EQ(UnpackFaceDirection(uiFace), DOWN);
+    EXPECT_EQ(UnpackFaceTile(uiFace), 255);
+
+    // DOWN runs U along X and V along Z, corners counter-clockwise seen from below
+    int arrCorner[3];
+    GetChunkFaceCorner(uiFace, 2, arrCorner);
+    EXPECT_EQ(arrCorner[0], 2 * CHUNK_SIZE - 1);
+    EXPECT_EQ(arrCorner[1], 7);
+    EXPECT_EQ(arrCorner[2], 1);
+}
+
+TEST(ChunkMeshTest, MesherComparison) {
+    const MeshingMode arrModes[] = {MeshingMode::NAIVE, MeshingMode::GREEDY};
+    const char* arrNames[] = {"Naive", "Greedy"};
+    const int iNbChunks = 64;
+    for (int iMode = 0; iMode < 2; ++iMode) {
+        size_t iNbVertices = 0;
+        double dMs = 0.0;
+        for (int iChunk = 0; iChunk < iNbChunks; ++iChunk) {
+            Chunk objChunk(iChunk % 8, iChunk / 8);
+            auto objStart = std::chrono::high_resolution_clock::now();
+            objChunk.ReconstructMesh(true, arrModes[iMode]);
+            auto objEnd = std::chrono::high_resolution_clock::now();
+            dMs += std::chrono::duration<double, std::milli>(objEnd - objStart).count();
+            iNbVertices += objChunk.GetMeshFaces().size() * 4;
+        }
+        std::cout << "[          ] " << arrNames[iMode] << ": " << iNbVertices << " vertices, "
+                  << dMs / iNbChunks << " ms per chunk" << std::endl;
+        EXPECT_GT(iNbVertices, 0u);
+    }
+}
+
+TEST(ChunkMeshTest, BinaryMasksMatchPerVoxelVisibility) {
+    // Random blocks in a chunk and its east / north neighbours, so the border bits matter
+    std::mt19937 objRng(1234);
+    std::uniform_int_distribution<int> objBlock(0, 3);
+    Chunk objChunk(0, 0), objEast(1, 0), objNorth(0, 1);
+    for (Chunk* pChunk : {&objChunk, &objEast, &objNorth}) {
+        std::vector<uint8_t> vecBlocks(CHUNK_VOL);
+        for (uint8_t& uiBlock : vecBlocks) uiBlock = static_cast<uint8_t>(objBlock(objRng) % 3);
+        pChunk->SetBlockData(vecBlocks.data());
+    }
+    objChunk.SetNeighbours(EAST, &objEast);
+    objChunk.SetNeighbours(NORTH, &objNorth);
+
+    const int arrOffsets[6][3] = {
+        {0, 0, 1}, {0, 0, -1}, {1, 0, 0}, {-1, 0, 0}, {0, 1, 0}, {0, -1, 0}};  // By Direction
+    for (bool bCulling : {false, true}) {
+        std::multiset<std::array<int, 4>> setExpected;
+        for (int iZ = 0; iZ < CHUNK_SIZE; ++iZ)
+            for (int iY = 0; iY < CHUNK_HEIGHT; ++iY)
+                for (int iX = 0; iX < CHUNK_SIZE; ++iX) {
+                    if (objChunk.GetBlockAt(iX, iY, iZ) == AIR)
+                        continue;
+                    for (int iDir = 0; iDir < 6; ++iDir) {
+                        const int* piOffset = arrOffsets[iDir];
+                        if (!bCulling || objChunk.GetBlockAt(iX + piOffset[0],
+                                                             iY + piOffset[1],
+                                                             iZ + piOffset[2]) == AIR)
+                            setExpected.insert({iX, iY, iZ, iDir});
+                    }
+                }
+
+        for (MeshingMode eMode : {MeshingMode::NAIVE, MeshingMode::GREEDY}) {
+            objChunk.ReconstructMesh(bCulling, eMode);
+            EXPECT_EQ(MeshedFaces(objChunk), setExpected)
+                << "Culling: " << bCulling << ", greedy: " << (eMode == MeshingMode::GREEDY);
+        }
+    }
+    objChunk.SetNeighbours(EAST, nullptr);
+    objChunk.SetNeighbours(NORTH, nullptr);
+}
+
+TEST(ChunkMeshTest, ThreadPoolMeshesMatchSynchronousMeshes) {
+    std::string strPathSync = "TestMeshingSync", strPathAsync = "TestMeshingAsync";
+    ChunkManager objSync(strPathSync), objAsync(strPathAsync);
+    objSync.SetActiveThreads(0);
+    objAsync.SetActiveThreads(4);
+    objSync.SetMeshingMode(MeshingMode::GREEDY);
+    objAsync.SetMeshingMode(MeshingMode::GREEDY);
+
+    // Synchronous mode loads and meshes the whole render radius in one call
+    objSync.Update(0.0f, 0.0f);
+    const size_t iNbChunks = objSync.GetChunks().size();
+    ASSERT_GT(iNbChunks, 0u);
+    EXPECT_EQ(objSync.GetPendingMeshCount(), 0u);
+
+    // Loads and meshes land over several frames; the last mesh of each chunk must see all of
+    // its neighbours, whatever order the jobs finished in
+    objAsync.Update(0.0f, 0.0f);
+    const auto tDeadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    while ((objAsync.GetChunks().size() < iNbChunks || objAsync.GetPendingMeshCount() > 0 ||
+            objAsync.GetPendingUploadCount() > 0) &&
+           std::chrono::steady_clock::now() < tDeadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        objAsync.Update(0.0f, 0.0f);
+    }
+    ASSERT_EQ(objAsync.GetChunks().size(), iNbChunks);
+    ASSERT_EQ(objAsync.GetPendingMeshCount(), 0u);
+    ASSERT_EQ(objAsync.GetPendingUploadCount(), 0u);
+
+    for (const auto& [Coords, pChunk] : objSync.GetChunks()) {
+        const Chunk* pAsyncChunk = objAsync.GetChunk(Coords.first, Coords.second);
+        ASSERT_NE(pAsyncChunk, nullptr);
+        size_t iSyncVertices = 0, iSyncTriangles = 0, iAsyncVertices = 0, iAsyncTriangles = 0;
+        pChunk->GetMeshStats(iSyncVertices, iSyncTriangles);
+        pAsyncChunk->GetMeshStats(iAsyncVertices, iAsyncTriangles);
+        EXPECT_EQ(iAsyncVertices, iSyncVertices);
+        EXPECT_EQ(iAsyncTriangles, iSyncTriangles);
+        EXPECT_TRUE(pAsyncChunk->IsValid());
+    }
+}
+
+TEST(ChunkMeshTest, RemeshQueueMeshesEachChunkOncePerFrame) {
+    std::string strPath = "TestMeshingQueue";
+    ChunkManager objChunkManager(strPath);
+    objChunkManager.SetActiveThreads(0);
+
+    // A whole radius arriving at once links every chunk to up to four later arrivals
+    objChunkManager.Update(0.0f, 0.0f);
+    EXPECT_EQ(objChunkManager.GetMeshedChunkCount(), objChunkManager.GetChunks().size());
+
+    // Two edits on the corner of chunk (0, 0): that chunk plus its west and south neighbours
+    objChunkManager.ResetMeshingTime();
+    objChunkManager.SetBlock(0, CHUNK_HEIGHT - 1, 0, STONE);
+    objChunkManager.SetBlock(0, CHUNK_HEIGHT - 2, 0, STONE);
+    EXPECT_EQ(objChunkManager.GetMeshedChunkCount(), 0u);
+    objChunkManager.Update(0.0f, 0.0f);
+    EXPECT_EQ(objChunkManager.GetMeshedChunkCount(), 3u);
+
+    // Nothing dirty: nothing remeshed
+    objChunkManager.Update(0.0f, 0.0f);
+    EXPECT_EQ(objChunkManager.GetMeshedChunkCount(), 3u);
+}
+
+TEST(ChunkMeshTest, UploadBudgetUploadsNearestChunksFirst) {
+    std::string strPath = "TestMeshingUploads";
+    ChunkManager objChunkManager(strPath);
+    objChunkManager.SetActiveThreads(4);
+    objChunkManager.SetMeshingMode(MeshingMode::NAIVE);
+
+    // Settle the world with the default budget
+    const auto tDeadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    auto isSettled = [&objChunkManager]() {
+        return objChunkManager.GetPendingMeshCount() == 0 &&
+               objChunkManager.GetPendingUploadCount() == 0;
+    };
+    objChunkManager.Update(0.0f, 0.0f);
+    while (!isSettled() && std::chrono::steady_clock::now() < tDeadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        objChunkManager.Update(0.0f, 0.0f);
+    }
+    ASSERT_TRUE(isSettled());
+
+    // Remesh everything greedily (every mesh shrinks) with a budget any mesh exceeds
+    objChunkManager.SetUploadBudget(1, 1000.0);
+    objChunkManager.SetMeshingMode(MeshingMode::GREEDY);
+    objChunkManager.ReloadAllChunks();
+    std::map<std::pair<int, int>, size_t> mapBytes;
+    for (const auto& [Coords, pChunk] : objChunkManager.GetChunks())
+        mapBytes[Coords] = pChunk->GetMeshByteSize();
+
+    // Once every job has landed, each frame uploads the nearest remaining chunk
+    float fLastDistance = -1.0f;
+    while (!isSettled() && std::chrono::steady_clock::now() < tDeadline) {
+        const bool bAllJobsLanded = objChunkManager.GetPendingMeshCount() == 0;
+        objChunkManager.Update(0.0f, 0.0f);
+        ASSERT_LE(objChunkManager.GetLastFrameUploadCount(), 1u);
+        for (auto& [Coords, iBytes] : mapBytes) {
+            const size_t iNewBytes =
+                objChunkManager.GetChunk(Coords.first, Coords.second)->GetMeshByteSize();
+            if (iNewBytes == iBytes)
+                continue;
+            EXPECT_LT(iNewBytes, iBytes);
+            iBytes = iNewBytes;
+            const float fX = (static_cast<float>(Coords.first) + 0.5f) * CHUNK_SIZE;
+            const float fZ = (static_cast<float>(Coords.second) + 0.5f) * CHUNK_SIZE;
+            const float fDistance = fX * fX + fZ * fZ;
+            if (bAllJobsLanded) {
+                EXPECT_GE(fDistance, fLastDistance);
+                fLastDistance = fDistance;
+            }
+        }
+    }
+    ASSERT_TRUE(isSettled());
+}
+
+TEST(ChunkMeshTest, GeometryArenaReusesAndMergesFreedRanges) {
+    const unsigned int uiBlock = Renderer::GeometryArena::BLOCK_WORDS;
+    Renderer::GeometryArena objArena(4 * uiBlock);
+    Renderer::GeometryArena::Range objA, objB, objC;
+    ASSERT_TRUE(objArena.Allocate(1, objA));
+    ASSERT_TRUE(objArena.Allocate(uiBlock + 1, objB));
+    ASSERT_TRUE(objArena.Allocate(uiBlock, objC));
+    EXPECT_EQ(objA.m_uiOffset, 0u);
+    EXPECT_EQ(objA.m_uiSize, uiBlock);  // Rounded up to whole blocks
+    EXPECT_EQ(objB.m_uiOffset, uiBlock);
+    EXPECT_EQ(objB.m_uiSize, 2 * uiBlock);
+    EXPECT_EQ(objC.m_uiOffset, 3 * uiBlock);
+    EXPECT_EQ(objArena.GetFreeRangeCount(), 0u);
+
+    // Freeing A then B leaves one gap at the front, which the next allocation fills
+    objArena.Free(objA);
+    objArena.Free(objB);
+    EXPECT_EQ(objArena.GetFreeRangeCount(), 1u);
+    EXPECT_EQ(objArena.GetUsedWords(), uiBlock);
+    Renderer::GeometryArena::Range objD;
+    ASSERT_TRUE(objArena.Allocate(3 * uiBlock, objD));
+    EXPECT_EQ(objD.m_uiOffset, 0u);
+
+    // Full: the buffer doubles and keeps what was written before
+    std::vector<uint32_t> vecWords(uiBlock);
+    for (unsigned int i = 0; i < uiBlock; ++i) vecWords[i] = 0xC0DE0000u + i;
+    objArena.Write(objC, vecWords.data(), uiBlock);
+    Renderer::GeometryArena::Range objE;
+    ASSERT_TRUE(objArena.Allocate(uiBlock, objE));
+    EXPECT_EQ(objArena.GetCapacity(), 8 * uiBlock);
+    EXPECT_EQ(objE.m_uiOffset, 4 * uiBlock);
+
+    std::vector<uint32_t> vecReadBack(uiBlock);
+    glGetNamedBufferSubData(objArena.GetID(),
+                            static_cast<GLintptr>(objC.m_uiOffset) * 4,
+                            static_cast<GLsizeiptr>(uiBlock) * 4,
+                            vecReadBack.data());
+    EXPECT_EQ(vecReadBack, vecWords);
+}
+
+TEST(ChunkMeshTest, ChunksShareTheGeometryArena) {
+    Renderer::GeometryArena objArena(1u << 16);
+    Chunk objA(0, 0), objB(1, 0);
+    objA.ReconstructMesh(true, MeshingMode::GREEDY);
+    objA.UploadMesh(objArena);
+    objB.ReconstructMesh(true, MeshingMode::GREEDY);
+    objB.UploadMesh(objArena);
+    ASSERT_GT(objA.GetMeshFaceCount(), 0u);
+    ASSERT_GT(objB.GetMeshFaceCount(), 0u);
+    EXPECT_GE(objB.GetMeshFaceOffset(), objA.GetMeshFaceOffset() + objA.GetMeshFaceCount());
+
+    // A remesh that still fits is rewritten in place; the faces read back match the CPU mesh
+    const unsigned int uiOffsetA = objA.GetMeshFaceOffset();
+    objA.ReconstructMesh(true, MeshingMode::GREEDY);
+    const std::vector<ChunkFace> vecFaces = objA.GetMeshFaces();
+    objA.UploadMesh(objArena);
+    EXPECT_EQ(objA.GetMeshFaceOffset(), uiOffsetA);
+    ASSERT_EQ(objA.GetMeshFaceCount(), vecFaces.size());
+
+    std::vector<ChunkFace> vecReadBack(vecFaces.size());
+    glGetNamedBufferSubData(objArena.GetID(),
+                            static_cast<GLintptr>(uiOffsetA) * sizeof(ChunkFace),
+                            static_cast<GLsizeiptr>(vecFaces.size() * sizeof(ChunkFace)),
+                            vecReadBack.data());
+    EXPECT_EQ(vecReadBack, vecFaces);
+
+    // Destroyed chunks give their ranges back
+    const unsigned int uiUsed = objArena.GetUsedWords();
+    {
+        Chunk objC(2, 0);
+        objC.ReconstructMesh(true, MeshingMode::GREEDY);
+        objC.UploadMesh(objArena);
+        EXPECT_GT(objArena.GetUsedWords(), uiUsed);
+    }
+    EXPECT_EQ(objArena.GetUsedWords(), uiUsed);
+}
+
+TEST(ChunkMeshTest, EmptyMeshTakesNoArenaRange) {
+    Renderer::GeometryArena objArena(1u << 16);
+    Chunk objChunk(0, 0);
+    objChunk.ReconstructMesh(true, MeshingMode::GREEDY);
+    objChunk.UploadMesh(objArena);
+    ASSERT_GT(objArena.GetUsedWords(), 0u);
+
+    // All air: the old range is given back and no block is taken for zero faces
+    std::vector<uint8_t> vecBlocks(CHUNK_VOL, AIR);
+    objChunk.SetBlockData(vecBlocks.data());
+    objChunk.ReconstructMesh(true, MeshingMode::GREEDY);
+    objChunk.UploadMesh(objArena);
+    EXPECT_EQ(objChunk.GetMeshFaceCount(), 0u);
+    EXPECT_EQ(objArena.GetUsedWords(), 0u);
+
+    Renderer::GeometryArena::Range objEmpty;
+    EXPECT_TRUE(objArena.Allocate(0, objEmpty));
+    EXPECT_EQ(objEmpty.m_uiSize, 0u);
+    EXPECT_EQ(objArena.GetUsedWords(), 0u);
+    EXPECT_EQ(objArena.GetFailedAllocationCount(), 0u);
+}
+
+TEST(ChunkMeshTest, RefusedMeshIsKeptForARetry) {
+    // Sized from the meshes below, but it has to outlive the chunks that free ranges into it
+    std::unique_ptr<Renderer::GeometryArena> pArena;
+    Chunk objA(0, 0), objB(1, 0);
+    objA.ReconstructMesh(true, MeshingMode::GREEDY);
+    objB.ReconstructMesh(true, MeshingMode::GREEDY);
+    auto RoundUp = [](size_t iNbFaces) {
+        const size_t iBlock = Renderer::GeometryArena::BLOCK_WORDS;
+        return static_cast<unsigned int>((iNbFaces + iBlock - 1) / iBlock * iBlock);
+    };
+    const unsigned int uiSizeA = RoundUp(objA.GetMeshFaces().size());
+    const unsigned int uiSizeB = RoundUp(objB.GetMeshFaces().size());
+    // Room for either mesh, but not for both
+    const unsigned int uiCapacity = std::max(uiSizeA, uiSizeB);
+    ASSERT_GT(uiSizeA + uiSizeB, uiCapacity);
+    pArena = std::make_unique<Renderer::GeometryArena>(uiCapacity, uiCapacity);
+    Renderer::GeometryArena& objArena = *pArena;
+
+    EXPECT_TRUE(objA.UploadMesh(objArena));
+    const size_t iNbFaces = objB.GetMeshFaces().size();
+    EXPECT_FALSE(objB.UploadMesh(objArena));
+    EXPECT_TRUE(objB.HasRefusedMesh());
+    EXPECT_EQ(objB.GetMeshFaceCount(), 0u);
+    EXPECT_EQ(objB.GetMeshFaces().size(), iNbFaces);
+    EXPECT_EQ(objArena.GetFailedAllocationCount(), 1u);
+
+    // Once A gives its range back, the same mesh goes up without a remesh
+    std::vector<uint8_t> vecBlocks(CHUNK_VOL, AIR);
+    objA.SetBlockData(vecBlocks.data());
+    objA.ReconstructMesh(true, MeshingMode::GREEDY);
+    EXPECT_TRUE(objA.UploadMesh(objArena));
+    EXPECT_TRUE(objB.UploadMesh(objArena));
+    EXPECT_FALSE(objB.HasRefusedMesh());
+    EXPECT_EQ(objB.GetMeshFaceCount(), iNbFaces);
+    EXPECT_TRUE(objB.GetMeshFaces().empty());
+}
+
+TEST(ChunkMeshTest, MeshDirectionRangesHoldOneDirectionEach) {
+    Renderer::GeometryArena objArena(1u << 16);
+    Chunk objPad(0, 0), objChunk(1, 0);
+    objPad.ReconstructMesh(true, MeshingMode::GREEDY);
+    objPad.UploadMesh(objArena);
+    for (MeshingMode eMode : {MeshingMode::NAIVE, MeshingMode::GREEDY}) {
+        objChunk.ReconstructMesh(true, eMode);
+        const std::vector<ChunkFace> vecFaces = objChunk.GetMeshFaces();
+        objChunk.UploadMesh(objArena);
+
+        // Six back-to-back ranges over the uploaded faces, each holding its own direction only
+        const unsigned int uiOffset = objChunk.GetMeshFaceOffset();
+        EXPECT_EQ(objChunk.GetMeshDirectionStart(FRONT), uiOffset);
+        EXPECT_EQ(objChunk.GetMeshDirectionStart(6), uiOffset + objChunk.GetMeshFaceCount());
+        for (int iDir = FRONT; iDir <= DOWN; ++iDir) {
+            const unsigned int uiStart = objChunk.GetMeshDirectionStart(iDir);
+            const unsigned int uiEnd = objChunk.GetMeshDirectionStart(iDir + 1);
+            ASSERT_LE(uiStart, uiEnd);
+            EXPECT_GT(uiEnd, uiStart) << "terrain shows faces in every direction";
+            for (unsigned int i = uiStart; i < uiEnd; ++i)
+                EXPECT_EQ(UnpackFaceDirection(vecFaces[i - uiOffset]), iDir);
+        }
+    }
+}
+
+TEST(ChunkMeshTest, CoarseMeshLodsSnapToCellsWithFewerFaces) {
+    for (MeshingMode eMode : {MeshingMode::NAIVE, MeshingMode::GREEDY}) {
+        Chunk objChunk(3, -2);
+        objChunk.ReconstructMesh(true, eMode);
+        size_t iPrevFaces = objChunk.GetMeshFaces().size();
+        for (int iLod = 1; iLod <= MESH_MAX_LOD; ++iLod) {
+            objChunk.SetMeshLod(iLod);
+            objChunk.ReconstructMesh(true, eMode);
+            const size_t iFaces = objChunk.GetMeshFaces().size();
+            EXPECT_GT(iFaces, 0u) << "Level: " << iLod;
+            EXPECT_LT(iFaces, iPrevFaces) << "Level: " << iLod;
+            iPrevFaces = iFaces;
+
+            // Every corner on the level's cell grid, inside the chunk
+            const int iScale = 1 << iLod;
+            const int arrDims[3] = {CHUNK_SIZE, CHUNK_HEIGHT, CHUNK_SIZE};
+            for (ChunkFace uiFace : objChunk.GetMeshFaces()) {
+                int arrCorners[4][3];
+                FaceCorners(uiFace, arrCorners);
+                for (const auto& arrCorner : arrCorners) {
+                    for (int i = 0; i < 3; ++i) {
+                        EXPECT_EQ(arrCorner[i] % iScale, 0) << "Level: " << iLod;
+                        EXPECT_GE(arrCorner[i], 0);
+                        EXPECT_LE(arrCorner[i], arrDims[i]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(ChunkMeshTest, MeshLodSeamsGetSkirts) {
+    // Two 4-layer slabs side by side along X
+    std::vector<uint8_t> vecBlocks(CHUNK_VOL, AIR);
+    for (int iZ = 0; iZ < CHUNK_SIZE; ++iZ)
+        for (int iY = 0; iY < 4; ++iY)
+            for (int iX = 0; iX < CHUNK_SIZE; ++iX)
+                vecBlocks[Chunk(0, 0).GetFlatIndexOf3DLayer(iX, iY, iZ)] = STONE;
+    Chunk objChunk(0, 0), objEast(1, 0);
+    objChunk.SetBlockData(vecBlocks.data());
+    objEast.SetBlockData(vecBlocks.data());
+    objChunk.SetNeighbours(EAST, &objEast);
+    objEast.SetNeighbours(WEST, &objChunk);
+
+    // Block faces on the shared border, facing east
+    auto BorderFaces = [&objChunk]() {
+        size_t iNbFaces = 0;
+        for (const std::array<int, 4>& arrFace : MeshedFaces(objChunk))
+            iNbFaces += arrFace[0] == CHUNK_SIZE - 1 && arrFace[3] == EAST;
+        return iNbFaces;
+    };
+    for (int iLod = 0; iLod <= MESH_MAX_LOD; ++iLod) {
+        for (int iEastLod = 0; iEastLod <= MESH_MAX_LOD; ++iEastLod) {
+            objChunk.SetMeshLod(iLod);
+            objEast.SetMeshLod(iEastLod);
+            objChunk.ReconstructMesh(true, MeshingMode::GREEDY);
+            // Same level: the border is culled as usual. Otherwise the slab is walled off up to
+            // its top at this chunk's level (4 blocks, or one 8-block cell)
+            const size_t iExpected =
+                iLod == iEastLod ? 0u : static_cast<size_t>(CHUNK_SIZE * std::max(4, 1 << iLod));
+            EXPECT_EQ(BorderFaces(), iExpected) << "Levels: " << iLod << ", " << iEastLod;
+        }
+    }
+}
+
+TEST(ChunkMeshTest, MeshLodFollowsThePlayerWithHysteresis) {
+    std::string strPath = "TestMeshLod";
+    ChunkManager objChunkManager(strPath);
+    objChunkManager.SetActiveThreads(0);
+    objChunkManager.SetRenderDistance(10);
+    objChunkManager.SetEnableMeshLod(true);
+    objChunkManager.SetMeshLodRadius(2);
+
+    auto LodAt = [&objChunkManager](int iChunkX) {
+        const Chunk* pChunk = objChunkManager.GetChunk(iChunkX, 0);
+        EXPECT_EQ(pChunk->GetUploadedMeshLod(), pChunk->GetMeshLod());
+        return pChunk->GetMeshLod();
+    };
+    auto UpdateInChunk = [&objChunkManager](int iChunkX) {
+        objChunkManager.Update((static_cast<float>(iChunkX) + 0.5f) * CHUNK_SIZE, 8.0f);
+    };
+
+    // Full resolution up to 2 chunks away, then one level per doubling of the radius
+    UpdateInChunk(0);
+    const int arrExpected[11] = {0, 0, 0, 1, 1, 2, 2, 2, 2, 3, 3};
+    for (int iChunkX = 0; iChunkX <= 10; ++iChunkX)
+        EXPECT_EQ(LodAt(iChunkX), arrExpected[iChunkX]) << "Chunk: " << iChunkX;
+    size_t iNbCounted = 0;
+    for (int iLod = 0; iLod <= MESH_MAX_LOD; ++iLod)
+        iNbCounted += objChunkManager.GetMeshLodChunkCount(iLod);
+    EXPECT_EQ(iNbCounted, objChunkManager.GetChunks().size());
+
+    // Chunk 3 refines as soon as it is 2 chunks away, but stepping back leaves it refined
+    // until it is 4 chunks away
+    UpdateInChunk(1);
+    EXPECT_EQ(LodAt(3), 0);
+    UpdateInChunk(0);
+    EXPECT_EQ(LodAt(3), 0);
+    UpdateInChunk(-1);
+    EXPECT_EQ(LodAt(3), 1);
+
+    // Turned off: everything back to full resolution
+    objChunkManager.SetEnableMeshLod(false);
+    UpdateInChunk(-1);
+    EXPECT_EQ(objChunkManager.GetMeshLodChunkCount(0), objChunkManager.GetChunks().size());
+}
+
+TEST(ChunkCullingTest, BatchCullingMatchesPerBoxTest) {
+    const Core::Mat4 objViewProjection =
+        Core::Mat4::Perspective(70.0f, 16.0f / 9.0f, 0.1f, 300.0f) *
+        Core::Mat4::LookAt(Core::Vec3(8.0f, 30.0f, 8.0f),
+                           Core::Vec3(60.0f, 10.0f, -40.0f),
+                           Core::Vec3(0.0f, 1.0f, 0.0f));
+    Frustum objFrustum;
+    objFrustum.Update(objViewProjection);
+
+    // A ragged count exercises the scalar tail after the 8-wide iterations
+    constexpr size_t NB_BOXES = 1003;
+    std::mt19937 objRng(21);
+    std::uniform_real_distribution<float> objPos(-400.0f, 400.0f);
+    std::uniform_real_distribution<float> objSize(0.0f, 24.0f);
+    std::vector<float> arrBounds[6];
+    for (size_t i = 0; i < NB_BOXES; ++i) {
+        for (int iAxis = 0; iAxis < 3; ++iAxis) {
+            const float fMin = objPos(objRng);
+            arrBounds[iAxis].push_back(fMin);
+            arrBounds[iAxis + 3].push_back(fMin + objSize(objRng));
+        }
+    }
+    const BoxArraySoA objBoxes = {arrBounds[0].data(),
+                                  arrBounds[1].data(),
+                                  arrBounds[2].data(),
+                                  arrBounds[3].data(),
+                                  arrBounds[4].data(),
+                                  arrBounds[5].data(),
+                                  NB_BOXES};
+
+    std::vector<uint32_t> vecExpected;
+    for (size_t i = 0; i < NB_BOXES; ++i) {
+        const AABB objBox(Core::Vec3(arrBounds[0][i], arrBounds[1][i], arrBounds[2][i]),
+                          Core::Vec3(arrBounds[3][i], arrBounds[4][i], arrBounds[5][i]));
+        if (objFrustum.IsBoxInVisibleFrustum(objBox))
+            vecExpected.push_back(static_cast<uint32_t>(i));
+    }
+    ASSERT_GT(vecExpected.size(), 0u);
+    ASSERT_LT(vecExpected.size(), NB_BOXES);
+
+    for (bool bUseSIMD : {false, true}) {
+        std::vector<uint32_t> vecVisible(NB_BOXES);
+        vecVisible.resize(objFrustum.CullBoxes(objBoxes, vecVisible.data(), bUseSIMD));
+        EXPECT_EQ(vecVisible, vecExpected) << "SIMD: " << bUseSIMD;
+    }
+}
+
+TEST(ChunkCullingTest, BoundsFollowLoadsEditsAndUnloads) {
+    // A 4-layer slab: placing above raises the box, removing that block lowers it again
+    std::vector<uint8_t> vecBlocks(CHUNK_VOL, AIR);
+    std::fill(vecBlocks.begin(), vecBlocks.begin() + 4 * CHUNK_SIZE, STONE);  // Row Z = 0
+    Chunk objChunk(0, 0);
+    objChunk.SetBlockData(vecBlocks.data());
+    EXPECT_EQ(objChunk.GetAABB().m_objMinPt.y, 0.0f);
+    EXPECT_EQ(objChunk.GetAABB().m_objMaxPt.y, 4.0f);
+    objChunk.SetBlockAt(3, 10, 3, STONE);
+    EXPECT_EQ(objChunk.GetAABB().m_objMaxPt.y, 11.0f);
+    objChunk.SetBlockAt(3, 10, 3, AIR);
+    EXPECT_EQ(objChunk.GetAABB().m_objMaxPt.y, 4.0f);
+
+    std::string strPath = "TestCullingBounds";
+    ChunkManager objChunkManager(strPath);
+    objChunkManager.SetActiveThreads(0);
+    objChunkManager.Update(0.0f, 0.0f);
+    const ChunkBoundsTable& objBounds = objChunkManager.GetChunkBounds();
+    ASSERT_EQ(objBounds.GetCount(), objChunkManager.GetChunks().size());
+
+    auto FindEntry = [&](const Chunk* pChunk) {
+        for (size_t i = 0; i < objBounds.GetCount(); ++i)
+            if (objBounds.GetChunk(i) == pChunk)
+                return i;
+        return objBounds.GetCount();
+    };
+    const Chunk* pOrigin = objChunkManager.GetChunk(0, 0);
+    objChunkManager.SetBlock(5, CHUNK_HEIGHT - 1, 5, STONE);
+    const size_t iEntry = FindEntry(pOrigin);
+    ASSERT_LT(iEntry, objBounds.GetCount());
+    EXPECT_EQ(objBounds.GetBoxes().m_pfMaxY[iEntry], static_cast<float>(CHUNK_HEIGHT));
+
+    // Far away: the old radius unloads, every entry still matches a loaded chunk's box
+    objChunkManager.Update(40.0f * CHUNK_SIZE, 0.0f);
+    ASSERT_EQ(objBounds.GetCount(), objChunkManager.GetChunks().size());
+    for (size_t i = 0; i < objBounds.GetCount(); ++i) {
+        const Chunk* pChunk = objBounds.GetChunk(i);
+        ASSERT_EQ(objChunkManager.GetChunk(pChunk->GetChunkX(), pChunk->GetChunkZ()), pChunk);
+        EXPECT_EQ(objBounds.GetBoxes().m_pfMinX[i], pChunk->GetAABB().m_objMinPt.x);
+        EXPECT_EQ(objBounds.GetBoxes().m_pfMaxY[i], pChunk->GetAABB().m_objMaxPt.y);
+    }
+}
+
+TEST(ChunkCullingTest, OccluderCellsFollowSolidColumns) {
+    // A 4-layer slab over the whole chunk: every cell occludes up to y = 4
+    std::vector<uint8_t> vecBlocks(CHUNK_VOL, AIR);
+    for (int iZ = 0; iZ < CHUNK_SIZE; ++iZ)
+        std::fill_n(vecBlocks.begin() + iZ * CHUNK_SIZE * CHUNK_HEIGHT, 4 * CHUNK_SIZE, STONE);
+    Chunk objChunk(0, 0);
+    objChunk.SetBlockData(vecBlocks.data());
+    for (int iCellX = 0; iCellX < OCCLUDER_CELLS; ++iCellX)
+        for (int iCellZ = 0; iCellZ < OCCLUDER_CELLS; ++iCellZ)
+            EXPECT_EQ(objChunk.GetOccluderHeight(iCellX, iCellZ), 4);
+
+    // A hole at the bottom of one column empties its cell only
+    objChunk.SetBlockAt(5, 0, 6, AIR);
+    EXPECT_EQ(objChunk.GetOccluderHeight(1, 1), 0);
+    EXPECT_EQ(objChunk.GetOccluderHeight(1, 2), 4);
+    objChunk.SetBlockAt(5, 0, 6, STONE);
+    EXPECT_EQ(objChunk.GetOccluderHeight(1, 1), 4);
+
+    // Blocks above an air gap do not count; a lower column lowers its cell
+    objChunk.SetBlockAt(0, 10, 0, STONE);
+    EXPECT_EQ(objChunk.GetOccluderHeight(0, 0), 4);
+    objChunk.SetBlockAt(3, 2, 3, AIR);
+    EXPECT_EQ(objChunk.GetOccluderHeight(0, 0), 2);
+}
+
+TEST(ChunkCullingTest, OcclusionBufferHidesBoxesBehindAWall) {
+    // Looking down -Z at a 10 x 10 wall, 10 blocks away
+    const Core::Mat4 objViewProjection =
+        Core::Mat4::Perspective(70.0f, 2.0f, 0.1f, 300.0f) *
+        Core::Mat4::LookAt(Core::Vec3(0.0f, 5.0f, 0.0f),
+                           Core::Vec3(0.0f, 5.0f, -1.0f),
+                           Core::Vec3(0.0f, 1.0f, 0.0f));
+    const AABB objWall(Core::Vec3(-5.0f, 0.0f, -12.0f), Core::Vec3(5.0f, 10.0f, -10.0f));
+    const AABB objBehind(Core::Vec3(-2.0f, 0.0f, -30.0f), Core::Vec3(2.0f, 4.0f, -26.0f));
+    const AABB objInFront(Core::Vec3(-2.0f, 0.0f, -8.0f), Core::Vec3(2.0f, 4.0f, -6.0f));
+    const AABB objBeside(Core::Vec3(20.0f, 0.0f, -30.0f), Core::Vec3(24.0f, 4.0f, -26.0f));
+    const AABB objAroundCamera(Core::Vec3(-1.0f, 4.0f, -1.0f), Core::Vec3(1.0f, 6.0f, 1.0f));
+
+    OcclusionBuffer objBuffer;
+    objBuffer.Begin(objViewProjection);
+    EXPECT_FALSE(objBuffer.IsOccluded(objBehind));
+    objBuffer.AddOccluder(objWall);
+    EXPECT_GT(objBuffer.GetDepth(OcclusionBuffer::WIDTH / 2, OcclusionBuffer::HEIGHT / 2), 0.0f);
+    EXPECT_TRUE(objBuffer.IsOccluded(objBehind));
+    EXPECT_FALSE(objBuffer.IsOccluded(objInFront));
+    EXPECT_FALSE(objBuffer.IsOccluded(objBeside));
+    EXPECT_FALSE(objBuffer.IsOccluded(objWall));
+    EXPECT_FALSE(objBuffer.IsOccluded(objAroundCamera));
+
+    // The same wall as two terrain columns: the faces between them are skipped, not needed
+    objBuffer.Begin(objViewProjection);
+    const float arrLeftNeighbours[4] = {0.0f, 10.0f, 0.0f, 0.0f};
+    const float arrRightNeighbours[4] = {10.0f, 0.0f, 0.0f, 0.0f};
+    objBuffer.AddOccluderColumn(
+        AABB(Core::Vec3(-5.0f, 0.0f, -12.0f), Core::Vec3(0.0f, 10.0f, -10.0f)), arrLeftNeighbours);
+    objBuffer.AddOccluderColumn(
+        AABB(Core::Vec3(0.0f, 0.0f, -12.0f), Core::Vec3(5.0f, 10.0f, -10.0f)), arrRightNeighbours);
+    EXPECT_TRUE(objBuffer.IsOccluded(objBehind));
+    EXPECT_FALSE(objBuffer.IsOccluded(objBeside));
+
+    // An occluder crossing the near plane is dropped rather than guessed
+    objBuffer.Begin(objViewProjection);
+    objBuffer.AddOccluder(objAroundCamera);
+    EXPECT_FALSE(objBuffer.IsOccluded(objBehind));
+}
+
+TEST(ChunkCullingTest, DrawListSortsBoxesFrontToBack) {
+    const Core::Vec3 objEye(8.0f, 30.0f, 8.0f);
+    const Core::Mat4 objPerspective =
+        Core::Mat4::Perspective(70.0f, 16.0f / 9.0f, 0.1f, 1000.0f) *
+        Core::Mat4::LookAt(objEye, Core::Vec3(60.0f, 10.0f, -40.0f), Core::Vec3(0.0f, 1.0f, 0.0f));
+    const Core::Mat4 objOrthographic =
+        Core::Mat4::Orthographic(-100.0f, 100.0f, -50.0f, 50.0f, -500.0f, 500.0f) *
+        Core::Mat4::LookAt(objEye, Core::Vec3(60.0f, 10.0f, -40.0f), Core::Vec3(0.0f, 1.0f, 0.0f));
+
+    // Chunk-sized boxes around the camera, every 4th one twice (equal depths)
+    constexpr size_t NB_BOXES = 5000;
+    std::mt19937 objRng(25);
+    std::uniform_int_distribution<int> objChunk(-40, 40);
+    auto ChunkMin = [&]() { return static_cast<float>(objChunk(objRng) * CHUNK_SIZE); };
+    std::vector<float> arrBounds[6];
+    for (size_t i = 0; i < NB_BOXES; ++i) {
+        const bool bRepeat = i % 4 == 3;
+        const float fMinX = bRepeat ? arrBounds[0].back() : ChunkMin();
+        const float fMinZ = bRepeat ? arrBounds[2].back() : ChunkMin();
+        const float arrBox[6] = {fMinX, 0.0f, fMinZ, fMinX + 16.0f, 16.0f, fMinZ + 16.0f};
+        for (int j = 0; j < 6; ++j) arrBounds[j].push_back(arrBox[j]);
+    }
+    const BoxArraySoA objBoxes = {arrBounds[0].data(),
+                                  arrBounds[1].data(),
+                                  arrBounds[2].data(),
+                                  arrBounds[3].data(),
+                                  arrBounds[4].data(),
+                                  arrBounds[5].data(),
+                                  NB_BOXES};
+
+    DrawListSorter objSorter;
+    for (const Core::Mat4* pViewProjection : {&objPerspective, &objOrthographic}) {
+        const float* e = pViewProjection->m_fElements;
+        auto Depth = [&](uint32_t uiIndex) {
+            const float fX = 0.5f * (arrBounds[0][uiIndex] + arrBounds[3][uiIndex]);
+            const float fY = 0.5f * (arrBounds[1][uiIndex] + arrBounds[4][uiIndex]);
+            const float fZ = 0.5f * (arrBounds[2][uiIndex] + arrBounds[5][uiIndex]);
+            return e[2] * fX + e[6] * fY + e[10] * fZ + e[14];
+        };
+        std::vector<uint32_t> vecIndices(NB_BOXES);
+        std::iota(vecIndices.begin(), vecIndices.end(), 0u);
+        float fMinDepth = Depth(0), fMaxDepth = fMinDepth;
+        for (uint32_t uiIndex : vecIndices) {
+            fMinDepth = std::min(fMinDepth, Depth(uiIndex));
+            fMaxDepth = std::max(fMaxDepth, Depth(uiIndex));
+        }
+
+        objSorter.SortFrontToBack(objBoxes, *pViewProjection, vecIndices.data(), NB_BOXES);
+
+        // A permutation, ordered up to one quantisation step, equal boxes in their former order
+        std::vector<uint32_t> vecSorted = vecIndices;
+        std::sort(vecSorted.begin(), vecSorted.end());
+        for (size_t i = 0; i < NB_BOXES; ++i) ASSERT_EQ(vecSorted[i], i);
+        const float fStep = (fMaxDepth - fMinDepth) / ((1 << DrawListSorter::KEY_BITS) - 1);
+        for (size_t i = 1; i < NB_BOXES; ++i) {
+            EXPECT_LE(Depth(vecIndices[i - 1]), Depth(vecIndices[i]) + fStep);
+            if (Depth(vecIndices[i - 1]) == Depth(vecIndices[i])) {
+                EXPECT_LT(vecIndices[i - 1], vecIndices[i]);
+            }
+        }
+    }
+}